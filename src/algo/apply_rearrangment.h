@@ -18,13 +18,36 @@
 #define ALGO_APPLY_REARRANGEMENT_H
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numeric>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <iostream>
 
+#include "algo/scratch_arena.h"
 #include "algo/type_functions.h"
+#include "simd/bits.h"
+#include "simd/pack.h"
 
 namespace algo {
+
+// Following cycles of a random permutation is a chain of dependent loads,
+// each a cache miss once the data and the positions don't fit into L2.
+// Above this many bytes apply_rearrangment distributes the elements through
+// cache sized blocks instead.
+inline static constexpr std::size_t apply_rearrangment_blocked_boundary =
+    std::size_t(1) << 20;
+inline static constexpr std::size_t apply_rearrangment_block_bytes =
+    std::size_t(1) << 18;
+// Each block is a separate output stream while distributing, too many
+// of them and we trash the TLB instead.
+inline static constexpr std::size_t apply_rearrangment_max_blocks = 256;
+
 namespace detail {
 
 template <typename II>
@@ -81,6 +104,180 @@ constexpr void cycle_from_position_no_marker(II f, II cur, ValueType<II> base) {
   *cur = marker;
 }
 
+inline std::size_t apply_rearrangment_block_shift(std::size_t n,
+                                                  std::size_t element_size) {
+  std::size_t shift = 0;
+  while ((element_size << shift) < apply_rearrangment_block_bytes) ++shift;
+  while ((n >> shift) >= apply_rearrangment_max_blocks) ++shift;
+  return shift;
+}
+
+// Not std::pair: the records don't need to be zeroed.
+template <typename N>
+struct rearrangment_source {
+  N source;
+  N destination;
+};
+
+template <typename N, typename T>
+struct rearrangment_destination {
+  N destination;
+  T value;
+};
+
+// source(i) is the index of the element that goes to i.
+template <typename N, typename S, typename I>
+// require UnsignedInteger<N> && Function<S, std::size_t(std::size_t)> &&
+//         RandomAccessIterator<I>
+void apply_rearrangment_blocked_impl(std::size_t n, S source, I base) {
+  using T = ValueType<I>;
+  using DI = DifferenceType<I>;
+
+  const std::size_t shift = apply_rearrangment_block_shift(n, sizeof(T));
+  const std::size_t blocks = ((n - 1) >> shift) + 1;
+
+  std::vector<std::size_t> starts(blocks + 1, 0);
+  for (std::size_t i = 0; i != n; ++i) ++starts[(source(i) >> shift) + 1];
+  std::partial_sum(starts.begin(), starts.end(), starts.begin());
+
+  // (source, destination) pairs, grouped by the source block.
+  scratch_arena by_source_arena;
+  scratch_buffer<rearrangment_source<N>> by_source(by_source_arena, n);
+  for (std::size_t i = 0; i != n; ++i) {
+    const std::size_t s = source(i);
+    by_source.begin()[starts[s >> shift]++] = {static_cast<N>(s),
+                                               static_cast<N>(i)};
+  }
+
+  // Each source block is read while it's in the cache, the values go
+  // to their destination blocks. Destinations are [0, n),
+  // so every destination block is full and doesn't need counting.
+  scratch_arena by_destination_arena;
+  scratch_buffer<rearrangment_destination<N, T>> by_destination(
+      by_destination_arena, n);
+  for (std::size_t b = 0; b != blocks; ++b) starts[b] = b << shift;
+
+  for (const auto& [s, d] : by_source) {
+    auto& out = by_destination.begin()[starts[d >> shift]++];
+    out.destination = d;
+    out.value = std::move(base[static_cast<DI>(s)]);
+  }
+
+  // Each destination block is written while it's in the cache.
+  for (auto& [d, x] : by_destination) {
+    base[static_cast<DI>(d)] = std::move(x);
+  }
+}
+
+template <typename II>
+// require RandomAccessIterator<II> && Position<ValueType<II>
+constexpr void apply_rearrangment_cycles(II f, II l, ValueType<II> base,
+                                         ValueType<II> marker) {
+  II cur = f;
+  while (cur != l) {
+    detail::cycle_from_position(f, cur, base, marker);
+    cur = std::find_if(++cur, l, [&](Reference<II> x) { return x != marker; });
+  }
+}
+
+inline void set_visited(std::uint64_t* visited, std::size_t i) {
+  visited[i / 64] |= std::uint64_t(1) << (i % 64);
+}
+
+template <typename II>
+// require RandomAccessIterator<II> && Position<ValueType<II>
+void cycle_from_position_visited_bits(II f, II cur, ValueType<II> base,
+                                      std::uint64_t* visited) {
+  // precondition: cur is not a fixed point
+  using N = DifferenceType<II>;
+  using I = ValueType<II>;
+  using T = ValueType<I>;
+
+  const N start = cur - f;
+  N next_n = N{*cur - base};
+
+  T tmp = std::move(**cur);
+
+  do {
+    II next_cur = f + next_n;
+    **cur = std::move(**next_cur);
+    cur = next_cur;
+    set_visited(visited, static_cast<std::size_t>(next_n));
+    next_n = N{*cur - base};
+  } while (next_n != start);
+
+  **cur = std::move(tmp);
+}
+
+template <typename II, typename I>
+// require RandomAccessIterator<II> && UnsignedInteger<ValueType<II>> &&
+//         RandomAccessIterator<I>
+constexpr void cycle_from_index(II f, II cur, I base, ValueType<II> marker) {
+  using N = ValueType<II>;
+  using T = ValueType<I>;
+  using DI = DifferenceType<I>;
+
+  const N start = static_cast<N>(cur - f);
+  N next = *cur;
+
+  if (next == start) return;
+
+  T tmp = std::move(base[static_cast<DI>(start)]);
+  N i = start;
+
+  do {
+    base[static_cast<DI>(i)] = std::move(base[static_cast<DI>(next)]);
+    f[i] = marker;
+    i = next;
+    next = f[i];
+  } while (next != start);
+
+  base[static_cast<DI>(i)] = std::move(tmp);
+  f[i] = marker;
+}
+
+template <typename I>
+constexpr bool is_contiguous_iterator() {
+  using T = std::remove_const_t<ValueType<I>>;
+  return std::is_same_v<I, T*> || std::is_same_v<I, const T*> ||
+         std::is_same_v<I, typename std::vector<T>::iterator> ||
+         std::is_same_v<I, typename std::vector<T>::const_iterator>;
+}
+
+// 32/64 bit integers in contiguous memory, indexes are 32 bit or
+// of the same width.
+template <typename II, typename I, typename O>
+constexpr bool rearrangment_gather_applicable() {
+  using N = std::remove_const_t<ValueType<II>>;
+  using T = std::remove_const_t<ValueType<I>>;
+  return is_contiguous_iterator<II>() && is_contiguous_iterator<I>() &&
+         is_contiguous_iterator<O>() && std::is_same_v<ValueType<O>, T> &&
+         std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8) &&
+         std::is_unsigned_v<N> && (sizeof(N) == 4 || sizeof(N) == sizeof(T));
+}
+
+template <typename N, typename T>
+void apply_rearrangment_indices_copy_simd(const N* f, std::size_t n,
+                                          const T* base, T* o) {
+  constexpr std::size_t width = 32 / sizeof(T);
+  using idx_pack = simd::pack<N, width>;
+
+  std::size_t i = 0;
+  // Two at a time: more loads in flight.
+  for (; i + 2 * width <= n; i += 2 * width) {
+    auto x = simd::gather(base, simd::load_unaligned<idx_pack>(f + i));
+    auto y =
+        simd::gather(base, simd::load_unaligned<idx_pack>(f + i + width));
+    simd::store_unaligned(o + i, x);
+    simd::store_unaligned(o + i + width, y);
+  }
+  for (; i + width <= n; i += width) {
+    simd::store_unaligned(
+        o + i, simd::gather(base, simd::load_unaligned<idx_pack>(f + i)));
+  }
+  for (; i != n; ++i) o[i] = base[f[i]];
+}
+
 }  // namespace detail
 
 template <typename II, typename O>
@@ -94,6 +291,32 @@ constexpr void apply_rearrangment_copy(II f, II l, O o) {
   }
 }
 
+template <typename II, typename I, typename O>
+// require ForwardIterator<II> && UnsignedInteger<ValueType<II>> &&
+//         RandomAccessIterator<I> && OutputIterator<O> &&
+//         std::is_same_v<ValueType<O>, ValueType<I>>
+void apply_rearrangment_indices_copy(II f, II l, I base, O o) {
+  // Same as apply_rearrangment_copy for index positions.
+  // For 32/64 bit integers in contiguous memory uses simd gathers.
+  // precondition: indexes are from [0, distance(f, l))
+  if constexpr (detail::rearrangment_gather_applicable<II, I, O>()) {
+    const auto n = static_cast<std::size_t>(l - f);
+    // Gather instructions treat indexes as signed.
+    using signed_n = std::make_signed_t<ValueType<II>>;
+    if (n && n - 1 <= std::size_t(std::numeric_limits<signed_n>::max())) {
+      detail::apply_rearrangment_indices_copy_simd(
+          std::addressof(*f), n, std::addressof(*base), std::addressof(*o));
+      return;
+    }
+  }
+
+  while (f != l) {
+    *o = base[static_cast<DifferenceType<I>>(*f)];
+    ++o;
+    ++f;
+  }
+}
+
 template <typename II, typename O>
 // require ForwardPositionIterator<II> && OutputIterator<O> &&
 //         std::is_same_v<ValueType<O>, ValueType<ValueType<II>>
@@ -105,19 +328,73 @@ constexpr void apply_rearrangment_move(II f, II l, O o) {
   }
 }
 
+template <typename II>
+// require RandomAccessIterator<II> && Position<ValueType<II>> &&
+//         RandomAccessIterator<ValueType<II>> &&
+//         DefaultConstructible<ValueType<ValueType<II>>>
+void apply_rearrangment_blocked(II f, II l, ValueType<II> base) {
+  // Distribution based: O(n) extra memory, but every pass is either
+  // sequential or stays within a cache sized block.
+  // Positions are not modified.
+  const auto n = static_cast<std::size_t>(l - f);
+  if (!n) return;
+
+  auto source = [&](std::size_t i) {
+    return static_cast<std::size_t>(f[static_cast<DifferenceType<II>>(i)] -
+                                    base);
+  };
+  if (n <= std::numeric_limits<std::uint32_t>::max()) {
+    detail::apply_rearrangment_blocked_impl<std::uint32_t>(n, source, base);
+  } else {
+    detail::apply_rearrangment_blocked_impl<std::size_t>(n, source, base);
+  }
+}
+
+template <typename II, typename I>
+// require RandomAccessIterator<II> && UnsignedInteger<ValueType<II>> &&
+//         RandomAccessIterator<I> && DefaultConstructible<ValueType<I>>
+void apply_rearrangment_indices_blocked(II f, II l, I base) {
+  // Same as apply_rearrangment_blocked, for index positions.
+  using N = ValueType<II>;
+
+  const auto n = static_cast<std::size_t>(l - f);
+  if (!n) return;
+
+  auto source = [&](std::size_t i) {
+    return static_cast<std::size_t>(f[static_cast<DifferenceType<II>>(i)]);
+  };
+  if constexpr (sizeof(N) <= sizeof(std::uint32_t)) {
+    detail::apply_rearrangment_blocked_impl<std::uint32_t>(n, source, base);
+  } else {
+    if (n <= std::numeric_limits<std::uint32_t>::max()) {
+      detail::apply_rearrangment_blocked_impl<std::uint32_t>(n, source, base);
+    } else {
+      detail::apply_rearrangment_blocked_impl<std::size_t>(n, source, base);
+    }
+  }
+}
+
 template <typename II>
 // require RandomAccessIterator<II> && Position<ValueType<II>
-constexpr void apply_rearrangment(II f, II l, ValueType<II> base,
-                                  ValueType<II> marker) {
+void apply_rearrangment(II f, II l, ValueType<II> base, ValueType<II> marker) {
   // precondition: positions from a range that f to l inducates
   //               are a permutation of a position sequence.
   //               base is the first position in that sequence.
   //               find(f, l, marker) == l
-  II cur = f;
-  while (cur != l) {
-    detail::cycle_from_position(f, cur, base, marker);
-    cur = std::find_if(++cur, l, [&](Reference<II> x) { return x != marker; });
+  // postcondition: positions in [f, l) are unspecified
+  //                (cycles overwrite them with marker, blocked doesn't).
+  using I = ValueType<II>;
+  using T = ValueType<I>;
+
+  if constexpr (RandomAccessIterator<I> &&
+                std::is_default_constructible_v<T>) {
+    const auto n = static_cast<std::size_t>(l - f);
+    if (n * (sizeof(T) + sizeof(I)) > apply_rearrangment_blocked_boundary) {
+      algo::apply_rearrangment_blocked(f, l, base);
+      return;
+    }
   }
+  detail::apply_rearrangment_cycles(f, l, base, marker);
 }
 
 template <typename II>
@@ -130,6 +407,62 @@ constexpr void apply_rearrangment_no_marker(II f, II l, ValueType<II> base) {
   }
 }
 
+template <typename II>
+// require RandomAccessIterator<II> && Position<ValueType<II>
+void apply_rearrangment_visited_bits(II f, II l, ValueType<II> base) {
+  // Processed positions are tracked in a bit vector, one bit per position,
+  // so the positions are not modified and no marker is needed.
+  const auto n = static_cast<std::size_t>(l - f);
+  std::vector<std::uint64_t> visited((n + 63) / 64, 0);
+  // Bits past the end are visited.
+  if (n % 64) visited.back() = ~std::uint64_t(0) << (n % 64);
+
+  for (std::size_t w = 0; w != visited.size(); ++w) {
+    // Fully visited words are skipped in one go.
+    std::uint64_t not_visited = ~visited[w];
+    while (not_visited) {
+      const std::size_t i =
+          w * 64 +
+          static_cast<std::size_t>(simd::count_trailing_zeroes(not_visited));
+      not_visited &= not_visited - 1;
+
+      // Fixed points and cycle starts are behind the scan, they are never
+      // written to the bit vector.
+      II cur = f + static_cast<DifferenceType<II>>(i);
+      if (static_cast<std::size_t>(*cur - base) == i) continue;
+
+      detail::cycle_from_position_visited_bits(f, cur, base, visited.data());
+      not_visited &= ~visited[w];
+    }
+  }
+}
+
+template <typename II, typename I>
+// require RandomAccessIterator<II> && UnsignedInteger<ValueType<II>> &&
+//         RandomAccessIterator<I>
+void apply_rearrangment_indices(II f, II l, I base, ValueType<II> marker) {
+  // Same as apply_rearrangment but the positions are indexes from base
+  // (see lift_as_indices). They are 2-4 times smaller than iterators.
+  // precondition: find(f, l, marker) == l
+  // postcondition: indexes in [f, l) are unspecified
+  using T = ValueType<I>;
+  using N = ValueType<II>;
+
+  if constexpr (std::is_default_constructible_v<T>) {
+    const auto n = static_cast<std::size_t>(l - f);
+    if (n * (sizeof(T) + sizeof(N)) > apply_rearrangment_blocked_boundary) {
+      algo::apply_rearrangment_indices_blocked(f, l, base);
+      return;
+    }
+  }
+
+  II cur = f;
+  while (cur != l) {
+    detail::cycle_from_index(f, cur, base, marker);
+    cur = std::find_if(++cur, l, [&](N x) { return x != marker; });
+  }
+}
+
 }  // namespace algo
 
 #endif  // ALGO_APPLY_REARRANGEMENT_H
@@ -20,9 +20,11 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <type_traits>
 
 #include "algo/advance_up_to.h"
 #include "algo/binary_search.h"
+#include "algo/find.h"
 #include "algo/half_nonnegative.h"
 
 namespace algo {
@@ -154,8 +156,15 @@ constexpr I lower_bound_biased(I f, I l, const V& v) {
 template <typename I, typename V, typename Comp>
 // require InputIterator<I> && StrictWeakOrdering<Comp, ValueType<I>, V>
 I lower_bound_linear(I f, I l, const V& v, Comp comp) {
-  return partition_point_linear(f, l,
-                                [&](Reference<I> x) { return comp(x, v); });
+  using T = std::remove_const_t<ValueType<I>>;
+  if constexpr (detail::find_simd_applicable<I, V>() &&
+                (std::is_same_v<Comp, std::less<>> ||
+                 std::is_same_v<Comp, std::less<T>>)) {
+    return detail::lower_bound_linear_simd(f, l, v);
+  } else {
+    return partition_point_linear(f, l,
+                                  [&](Reference<I> x) { return comp(x, v); });
+  }
 }
 
 template <typename I, typename V>
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_BINARY_SEARCH_INTERPOLATION_H
+#define ALGO_BINARY_SEARCH_INTERPOLATION_H
+
+#include <algorithm>
+#include <type_traits>
+
+#include "algo/half_nonnegative.h"
+#include "algo/type_functions.h"
+
+namespace algo {
+
+// Interpolation search: the next probe is where v would be if the values
+// between the ends of the range were spread evenly.
+// "Interpolation search - a log log N search", Perl, Itai, Avni.
+//
+// For uniform keys the distance between two probes goes as n, sqrt(n),
+// sqrt(sqrt(n)) ..., for the rest interpolation can be linear.
+// Every time the distance doesn't halve a binary search step is done too:
+// never more than twice the probes of lower_bound.
+template <typename I, typename V>
+// require RandomAccessIterator<I> && Arithmetic<ValueType<I>> &&
+//         Arithmetic<V>
+I lower_bound_interpolation(I f, I l, const V& v) {
+  static_assert(std::is_arithmetic_v<ValueType<I>> && std::is_arithmetic_v<V>);
+
+  auto narrow = [&](I m) {
+    if (*m < v) {
+      f = m + 1;
+    } else {
+      l = m;
+    }
+  };
+
+  // Everything before f is less than v, everything from l is not.
+  I last = f;
+  DifferenceType<I> last_step = l - f;
+  while (f != l) {
+    const DifferenceType<I> n = l - f;
+    const auto& lo = *f;
+    const auto& hi = *(l - 1);
+    if (!(lo < v)) return f;
+    if (hi < v) return l;
+
+    // lo < v <= hi, the answer is in (f, l - 1].
+    // Conversions to double can make big neighbouring integers equal.
+    const double lo_d = static_cast<double>(lo);
+    const double span = static_cast<double>(hi) - lo_d;
+    const double offset =
+        span > 0 ? (static_cast<double>(v) - lo_d) / span *
+                       static_cast<double>(n - 1)
+                 : 0;
+    const I m = f + std::clamp(static_cast<DifferenceType<I>>(offset),
+                               DifferenceType<I>(1), n - 1);
+    narrow(m);
+
+    const DifferenceType<I> step = m < last ? last - m : m - last;
+    last = m;
+    if (step <= last_step / 2) {
+      last_step = step;
+      continue;
+    }
+    last_step = step;
+
+    if (f != l) narrow(f + algo::half_nonnegative(l - f));
+  }
+  return f;
+}
+
+}  // namespace algo
+
+#endif  // ALGO_BINARY_SEARCH_INTERPOLATION_H
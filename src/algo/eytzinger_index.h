@@ -0,0 +1,154 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_EYTZINGER_INDEX_H
+#define ALGO_EYTZINGER_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "algo/type_functions.h"
+
+namespace algo {
+
+inline static constexpr std::size_t eytzinger_index_cache_line = 64;
+
+namespace detail {
+
+inline std::size_t eytzinger_log2(std::size_t x) {
+  return static_cast<std::size_t>(63 - __builtin_clzll(x));
+}
+
+// Position in the sorted order of the node k (1 based) of a complete
+// binary tree of n nodes: the position in the perfect tree of the same
+// height minus the missing leaves before it.
+inline std::size_t eytzinger_rank(std::size_t k, std::size_t n) {
+  const std::size_t height = eytzinger_log2(n);
+  const std::size_t depth = eytzinger_log2(k);
+  const std::size_t perfect =
+      ((2 * (k - (std::size_t(1) << depth)) + 1) << (height - depth)) - 1;
+
+  const std::size_t last_level = n - ((std::size_t(1) << height) - 1);
+  const std::size_t leaves_before = (perfect + 1) / 2;
+  return leaves_before > last_level ? perfect - (leaves_before - last_level)
+                                    : perfect;
+}
+
+}  // namespace detail
+
+// Copy of a sorted range in the breadth first order (Eytzinger layout):
+// children of the node k are 2k and 2k + 1.
+// "Array Layouts for Comparison-Based Searching", Khuong, Morin.
+//
+// The search has no branches, except for the loop, and prefetches
+// the descendants a cache line of nodes down: they are next to each other.
+// Good for big arrays that don't fit in cache, for small ones
+// the plain lower_bound is the same.
+template <typename T>
+class eytzinger_index {
+  // Nodes that fit in a cache line, the descendants this many
+  // times further down are prefetched.
+  static constexpr std::size_t prefetch_stride =
+      sizeof(T) < eytzinger_index_cache_line
+          ? eytzinger_index_cache_line / sizeof(T)
+          : 1;
+
+  std::vector<T> storage_;
+  // nodes_[0] is not used, nodes_ is aligned to the cache line (when
+  // T divides it), so that the prefetched descendants share one line.
+  const T* nodes_ = nullptr;
+  std::size_t size_ = 0;
+
+ public:
+  eytzinger_index() = default;
+  // The moved from index is empty.
+  eytzinger_index(eytzinger_index&& x) noexcept
+      : storage_(std::move(x.storage_)),
+        nodes_(std::exchange(x.nodes_, nullptr)),
+        size_(std::exchange(x.size_, 0)) {}
+
+  eytzinger_index& operator=(eytzinger_index&& x) noexcept {
+    storage_ = std::move(x.storage_);
+    nodes_ = std::exchange(x.nodes_, nullptr);
+    size_ = std::exchange(x.size_, 0);
+    return *this;
+  }
+
+  // The nodes point into the storage.
+  eytzinger_index(const eytzinger_index&) = delete;
+  eytzinger_index& operator=(const eytzinger_index&) = delete;
+
+  template <typename I>
+  // require RandomAccessIterator<I> && ValueType<I> == T
+  eytzinger_index(I f, I l) : size_(static_cast<std::size_t>(l - f)) {
+    storage_.resize(size_ + prefetch_stride);
+
+    std::size_t offset = 0;
+    if constexpr (eytzinger_index_cache_line % sizeof(T) == 0) {
+      const auto address = reinterpret_cast<std::uintptr_t>(storage_.data());
+      const std::size_t misalignment = address % eytzinger_index_cache_line;
+      if (misalignment % sizeof(T) == 0 && misalignment) {
+        offset = (eytzinger_index_cache_line - misalignment) / sizeof(T);
+      }
+    }
+
+    T* nodes = storage_.data() + offset;
+    for (std::size_t k = 1; k <= size_; ++k) {
+      nodes[k] = f[static_cast<DifferenceType<I>>(
+          detail::eytzinger_rank(k, size_))];
+    }
+    nodes_ = nodes;
+  }
+
+  std::size_t size() const { return size_; }
+
+  // Position of the lower bound in the original sorted range.
+  template <typename V, typename Comp>
+  // require StrictWeakOrdering<Comp, T, V>
+  std::size_t lower_bound(const V& v, Comp comp) const {
+    std::size_t k = 1;
+    while (k <= size_) {
+      // The descendants are past the end for the last levels: computed
+      // as an integer, because a pointer that far out of storage_ is UB,
+      // even if the prefetch never dereferences it.
+      __builtin_prefetch(reinterpret_cast<const void*>(
+          reinterpret_cast<std::uintptr_t>(nodes_) +
+          k * prefetch_stride * sizeof(T)));
+      k = 2 * k + static_cast<std::size_t>(comp(nodes_[k], v));
+    }
+
+    // Every step to the right adds a 1 at the end of k, the answer
+    // is the last step to the left: drop the trailing ones and a zero.
+    k >>= __builtin_ctzll(~static_cast<unsigned long long>(k)) + 1;
+    return k ? detail::eytzinger_rank(k, size_) : size_;
+  }
+
+  template <typename V>
+  std::size_t lower_bound(const V& v) const {
+    return lower_bound(v, std::less<>{});
+  }
+};
+
+template <typename I>
+eytzinger_index(I, I) -> eytzinger_index<ValueType<I>>;
+
+}  // namespace algo
+
+#endif  // ALGO_EYTZINGER_INDEX_H
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_FIND_H
+#define ALGO_FIND_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "algo/type_functions.h"
+#include "simd/pack.h"
+
+namespace algo {
+namespace detail {
+
+// Integers in memory we can get a pointer to.
+template <typename I, typename V>
+constexpr bool find_simd_applicable() {
+  using T = std::remove_const_t<ValueType<I>>;
+  return std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+         std::is_same_v<std::remove_cv_t<std::remove_reference_t<V>>, T> &&
+         (std::is_same_v<I, T*> || std::is_same_v<I, const T*> ||
+          std::is_same_v<I, typename std::vector<T>::iterator> ||
+          std::is_same_v<I, typename std::vector<T>::const_iterator>);
+}
+
+template <typename T>
+using find_simd_pack = simd::pack<T, 32 / sizeof(T)>;
+
+// The first element in [f, l) for which test is true.
+// test takes a pack and returns a mask, scalar_test is for ranges
+// shorter than a pack. The last pack is loaded so that it ends at l:
+// nothing past the end is read.
+template <typename T, typename Test, typename ScalarTest>
+const T* find_if_simd(const T* f, const T* l, Test test,
+                      ScalarTest scalar_test) {
+  using pack = find_simd_pack<T>;
+  constexpr std::ptrdiff_t size = simd::size_v<pack>;
+
+  if (l - f < size) return std::find_if(f, l, scalar_test);
+
+  // Two packs at a time: half the branches.
+  for (; l - f > 2 * size; f += 2 * size) {
+    const auto x = test(simd::load_unaligned<pack>(f));
+    const auto y = test(simd::load_unaligned<pack>(f + size));
+    if (!simd::any_true(x | y)) continue;
+
+    if (const auto match = simd::first_true(x)) return f + *match;
+    return f + size + *simd::first_true(y);
+  }
+
+  if (l - f > size) {
+    const auto match = simd::first_true(test(simd::load_unaligned<pack>(f)));
+    if (match) return f + *match;
+    f += size;
+  }
+
+  // Elements up to f have already been checked.
+  const T* last = l - size;
+  const auto match = simd::first_true_ignore_first_n(
+      test(simd::load_unaligned<pack>(last)),
+      static_cast<std::uint32_t>(f - last));
+  return match ? last + *match : l;
+}
+
+// Same as find_nth_if_guarantied: the n-th (0 based) element for which
+// test is true is known to be there. Like strlen, the loads are aligned,
+// so they can read past the end, but never touch the next page.
+template <typename T, typename Test>
+const T* find_nth_if_simd_guarantied(const T* f, std::size_t n, Test test) {
+  using pack = find_simd_pack<T>;
+  constexpr std::size_t size = simd::size_v<pack>;
+
+  const T* aligned_f = simd::previous_aligned_address<pack>(f);
+  auto ignore = static_cast<std::uint32_t>(f - aligned_f);
+
+  while (true) {
+    const auto mask = test(simd::load<pack>(aligned_f));
+    const std::uint32_t found = simd::count_true_ignore_first_n(mask, ignore);
+
+    if (n < found) {
+      std::uint32_t i = *simd::first_true_ignore_first_n(mask, ignore);
+      for (; n; --n) i = *simd::first_true_ignore_first_n(mask, i + 1);
+      return aligned_f + i;
+    }
+
+    n -= found;
+    aligned_f += size;
+    ignore = 0;
+  }
+}
+
+// find_if_simd for iterators.
+template <typename I, typename Test, typename ScalarTest>
+I find_if_simd(I f, I l, Test test, ScalarTest scalar_test) {
+  if (f == l) return l;
+
+  const auto* pf = std::addressof(*f);
+  const auto* found = find_if_simd(pf, pf + (l - f), test, scalar_test);
+  return f + (found - pf);
+}
+
+template <typename I, typename V>
+// require ContiguousIterator<I> && Integral<ValueType<I>>
+I lower_bound_linear_simd(I f, I l, const V& v) {
+  using pack = find_simd_pack<std::remove_const_t<ValueType<I>>>;
+  const pack x = simd::set_all<pack>(v);
+
+  return find_if_simd(
+      f, l, [&](const pack& y) { return ~simd::greater_pairwise(x, y); },
+      [&](const V& y) { return !(y < v); });
+}
+
+}  // namespace detail
+
+// std::find, with simd for integers in contiguous memory.
+template <typename I, typename V>
+// require InputIterator<I> && EqualityComparable<ValueType<I>, V>
+I find(I f, I l, const V& v) {
+  if constexpr (detail::find_simd_applicable<I, V>()) {
+    using pack = detail::find_simd_pack<std::remove_const_t<ValueType<I>>>;
+    const pack x = simd::set_all<pack>(v);
+
+    return detail::find_if_simd(
+        f, l, [&](const pack& y) { return simd::equal_pairwise(x, y); },
+        [&](const V& y) { return y == v; });
+  } else {
+    return std::find(f, l, v);
+  }
+}
+
+}  // namespace algo
+
+#endif  // ALGO_FIND_H
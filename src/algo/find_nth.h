@@ -17,6 +17,11 @@
 #ifndef ALGO_FIND_NTH_H
 #define ALGO_FIND_NTH_H
 
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include "algo/find.h"
 #include "algo/type_functions.h"
 
 namespace algo {
@@ -38,7 +43,20 @@ template <typename I, typename N, typename V>
 // require InputIterator<I> && Integral<N> &&
 //         EqualityComarable<ValueType<I>, V>
 I find_nth_guarantied(I f, N n, const V& v) {
-  return find_nth_if_guarantied(f, n, [&](Reference<I> x) { return x == v; });
+  if constexpr (detail::find_simd_applicable<I, V>()) {
+    using T = std::remove_const_t<ValueType<I>>;
+    using pack = detail::find_simd_pack<T>;
+    const pack x = simd::set_all<pack>(v);
+
+    const T* pf = std::addressof(*f);
+    const T* found = detail::find_nth_if_simd_guarantied(
+        pf, static_cast<std::size_t>(n),
+        [&](const pack& y) { return simd::equal_pairwise(x, y); });
+    return f + (found - pf);
+  } else {
+    return find_nth_if_guarantied(f, n,
+                                  [&](Reference<I> x) { return x == v; });
+  }
 }
 
 }  // namespace algo
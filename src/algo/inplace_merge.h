@@ -0,0 +1,182 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_INPLACE_MERGE_H
+#define ALGO_INPLACE_MERGE_H
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include "algo/binary_search.h"
+#include "algo/half_nonnegative.h"
+#include "algo/merge.h"
+#include "algo/move.h"
+#include "algo/type_functions.h"
+
+namespace algo {
+namespace detail {
+
+template <typename I, typename N, typename B>
+// require BidirectionalIterator<I> && Number<N> && ForwardIterator<B>
+I rotate_limited_buffer(I f, I m, I l, N n1, N n2, B buf, N buf_n) {
+  if (n1 <= n2 && n1 <= buf_n) {
+    B buf_l = algo::move(f, m, buf);
+    I res = algo::move(m, l, f);
+    algo::move(buf, buf_l, res);
+    return res;
+  }
+
+  if (n2 <= buf_n) {
+    B buf_l = algo::move(m, l, buf);
+    algo::move_backward(f, m, l);
+    return algo::move(buf, buf_l, f);
+  }
+
+  return std::rotate(f, m, l);
+}
+
+template <typename I, typename N, typename R, typename B>
+// require BidirectionalIterator<I> && Number<N>
+//         && WeakStrictOrdering<R, ValueType<I>> && ForwardIterator<B>
+void merge_adjacent_limited_buffer(I f, I m, I l, N n1, N n2, R r, B buf,
+                                   N buf_n) {
+  using MI = std::move_iterator<I>;
+  using MB = std::move_iterator<B>;
+
+  while (true) {
+    if (!n2) return;
+
+    // Skip what is already in place.
+    for (; n1; ++f, --n1) {
+      if (r(*m, *f)) break;
+    }
+    if (!n1) return;
+
+    // Otherwise the split below cannot make progress.
+    if (n1 == 1 && n2 == 1) {
+      std::iter_swap(f, m);
+      return;
+    }
+
+    if (n1 <= n2 && n1 <= buf_n) {
+      B buf_l = algo::move(f, m, buf);
+      algo::merge(MB(buf), MB(buf_l), MI(m), MI(l), f, r);
+      return;
+    }
+
+    if (n2 <= buf_n) {
+      B buf_l = algo::move(m, l, buf);
+
+      using RI = std::reverse_iterator<I>;
+      using RB = std::reverse_iterator<B>;
+      using MRI = std::move_iterator<RI>;
+      using MRB = std::move_iterator<RB>;
+
+      algo::merge(MRB(RB(buf_l)), MRB(RB(buf)), MRI(RI(m)), MRI(RI(f)), RI(l),
+                  [&](const auto& x, const auto& y) { return r(y, x); });
+      return;
+    }
+
+    // Symmerge like split: cut the bigger range in half, find where the
+    // middle goes in the other one and rotate the parts in between.
+    I cut1;
+    I cut2;
+    N n11;
+    N n22;
+    if (n1 > n2) {
+      n11 = algo::half_nonnegative(n1);
+      cut1 = std::next(f, n11);
+      cut2 = algo::lower_bound(m, l, *cut1, r);
+      n22 = N(std::distance(m, cut2));
+    } else {
+      n22 = algo::half_nonnegative(n2);
+      cut2 = std::next(m, n22);
+      cut1 = algo::partition_point(
+          f, m, [&](Reference<I> x) { return !r(*cut2, x); });
+      n11 = N(std::distance(f, cut1));
+    }
+
+    I new_m = rotate_limited_buffer(cut1, m, cut2, n1 - n11, n22, buf, buf_n);
+
+    // Recurse into the smaller part, loop on the bigger one.
+    const N n12 = n1 - n11;
+    const N n21 = n2 - n22;
+    if (n11 + n22 < n12 + n21) {
+      merge_adjacent_limited_buffer(f, cut1, new_m, n11, n22, r, buf, buf_n);
+      f = new_m; m = cut2; n1 = n12; n2 = n21;
+    } else {
+      merge_adjacent_limited_buffer(new_m, cut2, l, n12, n21, r, buf, buf_n);
+      l = new_m; m = cut1; n1 = n11; n2 = n22;
+    }
+  }
+}
+
+}  // namespace detail
+
+// Merges [f, m) and [m, l) in place, with buf_n elements of extra memory
+// (can be anything, min(distance(f, m), distance(m, l)) is enough for
+// one merge into the buffer).
+template <typename I, typename R, typename B>
+// require BidirectionalIterator<I> && WeakStrictOrdering<R, ValueType<I>>
+//         && ForwardIterator<B>
+void inplace_merge_limited_buffer(I f, I m, I l, R r, B buf,
+                                  DifferenceType<I> buf_n) {
+  detail::merge_adjacent_limited_buffer(f, m, l, std::distance(f, m),
+                                        std::distance(m, l), r, buf, buf_n);
+}
+
+template <typename I, typename B>
+void inplace_merge_limited_buffer(I f, I m, I l, B buf,
+                                  DifferenceType<I> buf_n) {
+  algo::inplace_merge_limited_buffer(f, m, l, std::less<>{}, buf, buf_n);
+}
+
+template <typename I, typename R>
+// require BidirectionalIterator<I> && WeakStrictOrdering<R, ValueType<I>>
+void inplace_merge_limited_allocation(I f, I m, I l, R r,
+                                      DifferenceType<I> max_buf_n) {
+  const DifferenceType<I> n1 = std::distance(f, m);
+  const DifferenceType<I> n2 = std::distance(m, l);
+  std::vector<ValueType<I>> buf(std::min({n1, n2, max_buf_n}));
+  detail::merge_adjacent_limited_buffer(f, m, l, n1, n2, r, buf.begin(),
+                                        DifferenceType<I>(buf.size()));
+}
+
+template <typename I>
+void inplace_merge_limited_allocation(I f, I m, I l,
+                                      DifferenceType<I> max_buf_n) {
+  algo::inplace_merge_limited_allocation(f, m, l, std::less<>{}, max_buf_n);
+}
+
+// No extra memory, only rotations.
+template <typename I, typename R>
+// require BidirectionalIterator<I> && WeakStrictOrdering<R, ValueType<I>>
+void inplace_merge(I f, I m, I l, R r) {
+  algo::inplace_merge_limited_buffer(f, m, l, r,
+                                     static_cast<ValueType<I>*>(nullptr),
+                                     DifferenceType<I>(0));
+}
+
+template <typename I>
+void inplace_merge(I f, I m, I l) {
+  algo::inplace_merge(f, m, l, std::less<>{});
+}
+
+}  // namespace algo
+
+#endif  // ALGO_INPLACE_MERGE_H
@@ -0,0 +1,177 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_LEARNED_INDEX_H
+#define ALGO_LEARNED_INDEX_H
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "algo/binary_search.h"
+#include "algo/binary_search_biased.h"
+#include "algo/type_functions.h"
+
+namespace algo {
+
+inline static constexpr std::size_t learned_index_max_error = 32;
+
+// A piecewise linear model of the position of a value in a sorted range
+// of numbers. "The Case for Learned Index Structures", Kraska et al.
+// Segments are built greedily, with a "shrinking cone" of slopes,
+// as in "FITing-Tree", Galakatos et al.
+//
+// The model of a segment is never more than error positions past the first
+// occurrence of its keys, so the search is lower_bound_biased from
+// the prediction minus the error.
+// The index keeps iterators, the range has to outlive it.
+template <typename I>
+// require RandomAccessIterator<I> && Arithmetic<ValueType<I>>
+class learned_index {
+  using T = ValueType<I>;
+  static_assert(std::is_arithmetic_v<T>);
+
+  struct segment {
+    double key;
+    double slope;
+    std::size_t position;
+    std::size_t error;
+  };
+
+  I f_;
+  I l_;
+  // First keys of the segments, apart from the rest for the search.
+  std::vector<T> keys_;
+  std::vector<segment> segments_;
+
+  std::size_t segment_end(std::size_t s) const {
+    return s + 1 != segments_.size() ? segments_[s + 1].position
+                                     : static_cast<std::size_t>(l_ - f_);
+  }
+
+  static std::size_t predict(const segment& seg, std::size_t end, double v) {
+    const double p = static_cast<double>(seg.position) +
+                     seg.slope * (v - seg.key);
+    return static_cast<std::size_t>(
+        std::clamp(p, static_cast<double>(seg.position),
+                   static_cast<double>(end)));
+  }
+
+  // Next distinct key.
+  I next_key(I x) const {
+    return algo::lower_bound_biased(x, l_, *x, [](const T& a, const T& b) {
+      return !(b < a);
+    });
+  }
+
+  // How far the model of the segment s overshoots the first occurrences
+  // of its keys.
+  std::size_t measure_error(std::size_t s) const {
+    const std::size_t end = segment_end(s);
+
+    std::size_t error = 0;
+    for (I x = f_ + static_cast<DifferenceType<I>>(segments_[s].position);
+         x != f_ + static_cast<DifferenceType<I>>(end); x = next_key(x)) {
+      const std::size_t position = static_cast<std::size_t>(x - f_);
+      const std::size_t predicted =
+          predict(segments_[s], end, static_cast<double>(*x));
+      if (predicted > position) error = std::max(error, predicted - position);
+    }
+    return error;
+  }
+
+ public:
+  learned_index() = default;
+
+  learned_index(I f, I l, std::size_t max_error = learned_index_max_error)
+      : f_(f), l_(l) {
+    constexpr double inf = std::numeric_limits<double>::infinity();
+    const double e = static_cast<double>(max_error);
+
+    double lo = 0;
+    double hi = inf;
+    auto close_segment = [&] {
+      segments_.back().slope = hi == inf ? 0 : (lo + hi) / 2;
+    };
+
+    for (I x = f; x != l; x = next_key(x)) {
+      const double key = static_cast<double>(*x);
+      const double position = static_cast<double>(x - f);
+
+      if (!segments_.empty()) {
+        const segment& seg = segments_.back();
+        const double dx = key - seg.key;
+        const double p0 = static_cast<double>(seg.position);
+        const double new_lo = std::max(lo, (position - e - p0) / dx);
+        const double new_hi = std::min(hi, (position + e - p0) / dx);
+        if (new_lo <= new_hi) {
+          lo = new_lo;
+          hi = new_hi;
+          continue;
+        }
+        close_segment();
+      }
+
+      keys_.push_back(*x);
+      segments_.push_back({key, 0, static_cast<std::size_t>(x - f), 0});
+      lo = 0;
+      hi = inf;
+    }
+    if (segments_.empty()) return;
+    close_segment();
+
+    // Errors are measured once all of the segments are known:
+    // a prediction is capped by the start of the next segment.
+    for (std::size_t s = 0; s != segments_.size(); ++s) {
+      segments_[s].error = measure_error(s);
+    }
+  }
+
+  std::size_t segments_count() const { return segments_.size(); }
+
+  I lower_bound(const T& v) const {
+    if (keys_.empty() || !(keys_.front() < v)) return f_;
+
+    // The last segment that starts with a key less than v.
+    const std::size_t s = static_cast<std::size_t>(
+        algo::partition_point(keys_.begin(), keys_.end(),
+                              [&](const T& x) { return x < v; }) -
+        keys_.begin() - 1);
+    const segment& seg = segments_[s];
+    const std::size_t end = segment_end(s);
+
+    const std::size_t predicted = predict(seg, end, static_cast<double>(v));
+    const std::size_t from = predicted - seg.position > seg.error
+                                 ? predicted - seg.error
+                                 : seg.position;
+
+    return algo::lower_bound_biased(f_ + static_cast<DifferenceType<I>>(from),
+                                    f_ + static_cast<DifferenceType<I>>(end),
+                                    v);
+  }
+};
+
+template <typename I>
+learned_index(I, I) -> learned_index<I>;
+
+template <typename I>
+learned_index(I, I, std::size_t) -> learned_index<I>;
+
+}  // namespace algo
+
+#endif  // ALGO_LEARNED_INDEX_H
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_LOWER_BOUND_BATCH_H
+#define ALGO_LOWER_BOUND_BATCH_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+
+#include "algo/binary_search_biased.h"
+#include "algo/type_functions.h"
+
+namespace algo {
+
+inline static constexpr std::size_t lower_bound_batch_group_size = 16;
+
+namespace detail {
+
+template <typename I, typename IQ, typename O, typename Comp>
+// require RandomAccessIterator<I> && ForwardIterator<IQ> &&
+//         OutputIterator<O, I> &&
+//         StrictWeakOrdering<Comp, ValueType<I>, ValueType<IQ>>
+O lower_bound_batch_group(I f, DifferenceType<I> n, IQ qf, std::size_t g,
+                          O o, Comp comp) {
+  std::array<I, lower_bound_batch_group_size> bases;
+  std::array<IQ, lower_bound_batch_group_size> queries;
+  for (std::size_t i = 0; i != g; ++i, ++qf) {
+    bases[i] = f;
+    queries[i] = qf;
+  }
+
+  // All searches have the same length, so they go round by round together.
+  // In a round the loads of different searches don't depend on each other
+  // and the next middle of each one is prefetched while the others go.
+  while (n > 1) {
+    const DifferenceType<I> half = n / 2;
+    n -= half;
+    for (std::size_t i = 0; i != g; ++i) {
+      I& base = bases[i];
+      base = comp(base[half], *queries[i]) ? base + half : base;
+      __builtin_prefetch(std::addressof(base[n / 2]));
+    }
+  }
+
+  for (std::size_t i = 0; i != g; ++i, ++o) {
+    const bool less = comp(*bases[i], *queries[i]);
+    *o = bases[i] + static_cast<DifferenceType<I>>(less);
+  }
+  return o;
+}
+
+}  // namespace detail
+
+// Lower bounds of all queries in [f, l), written to o.
+// Searches go in groups of lower_bound_batch_group_size:
+// branchless binary searches in lockstep, so that the cache misses
+// of different queries overlap.
+template <typename I, typename IQ, typename O, typename Comp>
+// require RandomAccessIterator<I> && ForwardIterator<IQ> &&
+//         OutputIterator<O, I> &&
+//         StrictWeakOrdering<Comp, ValueType<I>, ValueType<IQ>>
+O lower_bound_batch(I f, I l, IQ qf, IQ ql, O o, Comp comp) {
+  if (f == l) return std::fill_n(o, std::distance(qf, ql), f);
+
+  const DifferenceType<I> n = l - f;
+  while (qf != ql) {
+    IQ qm = qf;
+    std::size_t g = 0;
+    for (; g != lower_bound_batch_group_size && qm != ql; ++g) ++qm;
+
+    o = detail::lower_bound_batch_group(f, n, qf, g, o, comp);
+    qf = qm;
+  }
+  return o;
+}
+
+template <typename I, typename IQ, typename O>
+// require RandomAccessIterator<I> && ForwardIterator<IQ> &&
+//         OutputIterator<O, I> && TotallyOrdered<ValueType<I>, ValueType<IQ>>
+O lower_bound_batch(I f, I l, IQ qf, IQ ql, O o) {
+  return algo::lower_bound_batch(f, l, qf, ql, o, std::less<>{});
+}
+
+// Same as lower_bound_batch for sorted queries: every search starts from
+// the previous answer with lower_bound_hinted. The queries don't have to be
+// sorted for the result to be correct, only for it to be fast.
+template <typename I, typename IQ, typename O, typename Comp>
+// require BidirectionalIterator<I> && InputIterator<IQ> &&
+//         OutputIterator<O, I> &&
+//         StrictWeakOrdering<Comp, ValueType<I>, ValueType<IQ>>
+O lower_bound_batch_sorted(I f, I l, IQ qf, IQ ql, O o, Comp comp) {
+  I hint = f;
+  for (; qf != ql; ++qf, ++o) {
+    hint = algo::lower_bound_hinted(f, hint, l, *qf, comp);
+    *o = hint;
+  }
+  return o;
+}
+
+template <typename I, typename IQ, typename O>
+// require BidirectionalIterator<I> && InputIterator<IQ> &&
+//         OutputIterator<O, I> && TotallyOrdered<ValueType<I>, ValueType<IQ>>
+O lower_bound_batch_sorted(I f, I l, IQ qf, IQ ql, O o) {
+  return algo::lower_bound_batch_sorted(f, l, qf, ql, o, std::less<>{});
+}
+
+}  // namespace algo
+
+#endif  // ALGO_LOWER_BOUND_BATCH_H
@@ -17,9 +17,12 @@
 #ifndef ALGO_MERGE_H
 #define ALGO_MERGE_H
 
+#include <algorithm>
 #include <functional>
+#include <type_traits>
 
 #include "algo/copy.h"
+#include "algo/type_functions.h"
 
 namespace algo {
 
@@ -80,6 +83,63 @@ O merge(I1 f1, I1 l1, I2 f2, I2 l2, O o) {
   return algo::merge(f1, l1, f2, l2, o, std::less<>{});
 }
 
+namespace detail {
+
+template <typename I1, typename I2>
+constexpr bool merge_branchless_applicable() {
+  if constexpr (!RandomAccessIterator<I1> || !RandomAccessIterator<I2>) {
+    return false;
+  } else {
+    using T = ValueType<I1>;
+    return std::is_same_v<T, ValueType<I2>> &&
+           std::is_trivially_copyable_v<T> &&
+           (std::is_arithmetic_v<T> || std::is_pointer_v<T>);
+  }
+}
+
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R> && RandomAccessIterator<I1, I2>
+O merge_branchless_impl(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r) {
+  using T = ValueType<I1>;
+
+  // Neither of the ranges can run out in less than min(n1, n2) steps,
+  // so the inner loop only checks one counter.
+  while (true) {
+    auto n = std::min<DifferenceType<I1>>(l1 - f1, l2 - f2);
+    if (!n) break;
+
+    for (; n; --n) {
+      const T x = *f1;
+      const T y = *f2;
+      const bool take_second = r(y, x);
+      *o = take_second ? y : x;
+      ++o;
+      f1 += !take_second;
+      f2 += take_second;
+    }
+  }
+
+  o = algo::copy(f1, l1, o);
+  return algo::copy(f2, l2, o);
+}
+
+}  // namespace detail
+
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R>
+O merge_branchless(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r) {
+  if constexpr (detail::merge_branchless_applicable<I1, I2>()) {
+    return detail::merge_branchless_impl(f1, l1, f2, l2, o, r);
+  } else {
+    return algo::merge(f1, l1, f2, l2, o, r);
+  }
+}
+
+template <typename I1, typename I2, typename O>
+O merge_branchless(I1 f1, I1 l1, I2 f2, I2 l2, O o) {
+  return algo::merge_branchless(f1, l1, f2, l2, o, std::less<>{});
+}
+
 }  // namespace algo
 
 #endif  // ALGO_MERGE_H
@@ -17,6 +17,7 @@
 #ifndef ALGO_MERGE_BIASED_H
 #define ALGO_MERGE_BIASED_H
 
+#include <cstddef>
 #include <functional>
 
 #include "algo/binary_search_biased.h"
@@ -101,6 +102,73 @@ O merge_biased_second(I1 f1, I1 l1, I2 f2, I2 l2, O o) {
   return merge_biased_second(f1, l1, f2, l2, o, std::less<>{});
 }
 
+// After how many elements in a row from the same range merge_adaptive
+// starts galloping.
+inline static constexpr std::size_t merge_adaptive_gallop_boundary = 4;
+
+template <std::size_t gallop_after = merge_adaptive_gallop_boundary,
+          typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R> && ForwardIterator<I1, I2>
+O merge_adaptive(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r) {
+  static_assert(gallop_after > 0);
+
+  std::size_t streak;
+
+  if (f1 == l1) goto copySecond;
+  if (f2 == l2) goto copyFirst;
+
+  if (r(*f2, *f1)) goto takeSecond;
+
+  // clang-format off
+takeFirst:
+  streak = 0;
+  while (true) {
+    *o = *f1; ++o; ++f1; if (f1 == l1) goto copySecond;
+    if (r(*f2, *f1)) goto takeSecond;
+    if (++streak == gallop_after) break;
+  }
+  // clang-format on
+
+  // First range keeps winning: jump ahead.
+  {
+    I1 next_f1 = algo::point_closer_to_upper_bound(f1, l1, *f2, r);
+    o = algo::copy(f1, next_f1, o);
+    f1 = next_f1;
+  }
+  if (r(*f2, *f1)) goto takeSecond;
+  goto takeFirst;
+
+  // clang-format off
+takeSecond:
+  streak = 0;
+  while (true) {
+    *o = *f2; ++o; ++f2; if (f2 == l2) goto copyFirst;
+    if (!r(*f2, *f1)) goto takeFirst;
+    if (++streak == gallop_after) break;
+  }
+  // clang-format on
+
+  // Same for the second.
+  {
+    I2 next_f2 = algo::point_closer_to_lower_bound(f2, l2, *f1, r);
+    o = algo::copy(f2, next_f2, o);
+    f2 = next_f2;
+  }
+  if (!r(*f2, *f1)) goto takeFirst;
+  goto takeSecond;
+
+copySecond:
+  return algo::copy(f2, l2, o);
+copyFirst:
+  return algo::copy(f1, l1, o);
+}
+
+template <std::size_t gallop_after = merge_adaptive_gallop_boundary,
+          typename I1, typename I2, typename O>
+O merge_adaptive(I1 f1, I1 l1, I2 f2, I2 l2, O o) {
+  return merge_adaptive<gallop_after>(f1, l1, f2, l2, o, std::less<>{});
+}
+
 }  // namespace algo
 
 #endif  // ALGO_MERGE_BIASED_H
@@ -0,0 +1,255 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_MERGE_BITONIC_H
+#define ALGO_MERGE_BITONIC_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "algo/merge.h"
+#include "algo/sorting_network.h"
+#include "algo/type_functions.h"
+#include "simd/pack.h"
+
+namespace algo {
+namespace detail {
+
+// Iterators of T we can get the memory of.
+template <typename I, typename T>
+constexpr bool merge_bitonic_contiguous() {
+  return std::is_same_v<I, T*> || std::is_same_v<I, const T*> ||
+         std::is_same_v<I, typename std::vector<T>::iterator> ||
+         std::is_same_v<I, typename std::vector<T>::const_iterator>;
+}
+
+template <typename I1, typename I2, typename O, typename R>
+constexpr bool merge_bitonic_applicable() {
+  using T = std::remove_const_t<ValueType<I1>>;
+  if constexpr (!sorting_network_supported_type<T>()) {
+    return false;
+  } else {
+    return merge_bitonic_contiguous<I1, T>() &&
+           merge_bitonic_contiguous<I2, T>() &&
+           merge_bitonic_contiguous<O, T>() &&
+           (std::is_same_v<R, std::less<>> || std::is_same_v<R, std::less<T>>);
+  }
+}
+
+// Bitonic merge of K registers, everything is in registers:
+// the compare exchanges in between registers are min/max,
+// inside of one - a shuffle, min/max and a blend.
+template <typename Pack, std::size_t K>
+class merge_bitonic_network {
+  static constexpr std::size_t size = simd::size_v<Pack>;
+  static constexpr std::size_t steps = [] {
+    std::size_t res = 0;
+    for (std::size_t x = size; x > 1; x /= 2) ++res;
+    return res;
+  }();
+
+  using vbool = simd::vbool_t<Pack>;
+  using masks_t = std::array<vbool, steps>;
+
+  // Masks don't depend on the data, they are computed once per merge.
+  masks_t ascending_;
+  masks_t descending_;
+
+  template <std::size_t step>
+  static constexpr std::size_t distance() {
+    return size >> (step + 1);
+  }
+
+  template <std::size_t step>
+  static void clean_register(Pack& reg, const masks_t& masks) {
+    if constexpr (step < steps) {
+      constexpr std::size_t x = distance<step>();
+      constexpr auto idx = [] {
+        std::array<std::uint32_t, size> res{};
+        for (std::size_t i = 0; i != size; ++i) res[i] = i ^ x;
+        return res;
+      }();
+
+      const Pack swapped = simd::shuffle(reg, idx);
+      reg = simd::blend(simd::min_pairwise(reg, swapped),
+                        simd::max_pairwise(reg, swapped), masks[step]);
+      clean_register<step + 1>(reg, masks);
+    }
+  }
+
+  // Sorts a bitonic sequence of K registers.
+  template <bool descending, std::size_t x = K / 2>
+  void clean(std::array<Pack, K>& regs) const {
+    if constexpr (x > 0) {
+      for (std::size_t r = 0; r != K; ++r) {
+        if (r & x) continue;
+        const Pack min = simd::min_pairwise(regs[r], regs[r + x]);
+        const Pack max = simd::max_pairwise(regs[r], regs[r + x]);
+        regs[r] = descending ? max : min;
+        regs[r + x] = descending ? min : max;
+      }
+      clean<descending, x / 2>(regs);
+    } else {
+      for (auto& reg : regs) {
+        clean_register<0>(reg, descending ? descending_ : ascending_);
+      }
+    }
+  }
+
+ public:
+  merge_bitonic_network() {
+    constexpr auto make_masks = [](bool descending) {
+      std::array<std::array<bool, size>, steps> res{};
+      for (std::size_t step = 0; step != steps; ++step) {
+        const std::size_t x = size >> (step + 1);
+        for (std::size_t i = 0; i != size; ++i) {
+          res[step][i] = static_cast<bool>(i & x) != descending;
+        }
+      }
+      return res;
+    };
+
+    for (std::size_t step = 0; step != steps; ++step) {
+      ascending_[step] = simd::mask_from_bools<Pack>(make_masks(false)[step]);
+      descending_[step] = simd::mask_from_bools<Pack>(make_masks(true)[step]);
+    }
+  }
+
+  // low is sorted ascending, high - descending. Afterwards low has
+  // the smaller half, in ascending order, high - the bigger, descending.
+  void merge(std::array<Pack, K>& low, std::array<Pack, K>& high) const {
+    for (std::size_t r = 0; r != K; ++r) {
+      const Pack min = simd::min_pairwise(low[r], high[r]);
+      high[r] = simd::max_pairwise(low[r], high[r]);
+      low[r] = min;
+    }
+    clean<false>(low);
+    clean<true>(high);
+  }
+};
+
+// Elements per block: one register is too little work to hide
+// the latencies of shuffles.
+inline static constexpr std::size_t merge_bitonic_block_size = 16;
+
+// "Efficient implementation of sorting on multi-core SIMD CPU architecture",
+// Chhugani et al.
+template <typename T>
+T* merge_bitonic_impl(const T* f1, const T* l1, const T* f2, const T* l2,
+                      T* o) {
+  using pack_t = sorting_network_pack<T>;
+  constexpr std::ptrdiff_t size = simd::size_v<pack_t>;
+  constexpr std::ptrdiff_t block = merge_bitonic_block_size;
+  constexpr std::size_t K = block / size;
+
+  if (l1 - f1 < block || l2 - f2 < block) {
+    return algo::merge(f1, l1, f2, l2, o, std::less<>{});
+  }
+
+  const merge_bitonic_network<pack_t, K> network;
+
+  const auto load_block = [](const T* f) {
+    std::array<pack_t, K> res;
+    for (std::size_t r = 0; r != K; ++r) {
+      res[r] = simd::load_unaligned<pack_t>(f + r * size);
+    }
+    return res;
+  };
+
+  // kept has the biggest block elements seen so far, in descending order:
+  // the next block comes from the input with the smaller head,
+  // so everything smaller than them has been seen already.
+  std::array<pack_t, K> low = load_block(f1);
+  std::array<pack_t, K> kept;
+  {
+    const std::array<pack_t, K> ascending = load_block(f2);
+    for (std::size_t r = 0; r != K; ++r) {
+      kept[r] = sorting_network_reverse(ascending[K - 1 - r]);
+    }
+  }
+  f1 += block;
+  f2 += block;
+
+  while (true) {
+    network.merge(low, kept);
+    for (std::size_t r = 0; r != K; ++r) {
+      simd::store_unaligned(o + r * size, low[r]);
+    }
+    o += block;
+
+    if (l1 - f1 < block || l2 - f2 < block) break;
+
+    // Indexing instead of a ternary: the compiler turns the ternary into
+    // a branch, which is mispredicted on every other block.
+    const std::ptrdiff_t take_first = !(*f2 < *f1);
+    const T* heads[2] = {f2, f1};
+    low = load_block(heads[take_first]);
+    f1 += block * take_first;
+    f2 += block * (1 - take_first);
+  }
+
+  // Leftovers from kept and the shorter input are merged on the stack,
+  // the longer input goes through the scalar merge.
+  const bool first_is_short = l1 - f1 < block;
+  const T* short_f = first_is_short ? f1 : f2;
+  const T* short_l = first_is_short ? l1 : l2;
+  const T* long_f = first_is_short ? f2 : f1;
+  const T* long_l = first_is_short ? l2 : l1;
+
+  std::array<T, block> kept_elements;
+  for (std::size_t r = 0; r != K; ++r) {
+    simd::store_unaligned(kept_elements.data() + r * size, kept[r]);
+  }
+  std::reverse(kept_elements.begin(), kept_elements.end());
+
+  std::array<T, 2 * block> tail;
+  T* tail_l = algo::merge(kept_elements.begin(), kept_elements.end(), short_f,
+                          short_l, tail.begin(), std::less<>{});
+
+  return algo::merge(tail.begin(), tail_l, long_f, long_l, o, std::less<>{});
+}
+
+}  // namespace detail
+
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R> && ForwardIterator<I1, I2>
+O merge_bitonic(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r) {
+  if constexpr (detail::merge_bitonic_applicable<I1, I2, O, R>()) {
+    // Equal integers are indistinguishable, so the result is the same
+    // as the stable merge.
+    if (f1 == l1 || f2 == l2) return algo::merge(f1, l1, f2, l2, o, r);
+
+    detail::merge_bitonic_impl(&*f1, &*f1 + (l1 - f1), &*f2,
+                               &*f2 + (l2 - f2), &*o);
+    return o + ((l1 - f1) + (l2 - f2));
+  } else {
+    return algo::merge(f1, l1, f2, l2, o, r);
+  }
+}
+
+template <typename I1, typename I2, typename O>
+O merge_bitonic(I1 f1, I1 l1, I2 f2, I2 l2, O o) {
+  return algo::merge_bitonic(f1, l1, f2, l2, o, std::less<>{});
+}
+
+}  // namespace algo
+
+#endif  // ALGO_MERGE_BITONIC_H
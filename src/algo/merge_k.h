@@ -0,0 +1,168 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_MERGE_K_H
+#define ALGO_MERGE_K_H
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "algo/binary_search_biased.h"
+#include "algo/copy.h"
+#include "algo/type_functions.h"
+
+namespace algo {
+
+// After how many elements in a row from the same run we start galloping.
+inline static constexpr std::size_t merge_k_gallop_boundary = 4;
+
+namespace detail {
+
+template <typename I, typename R>
+// require ForwardIterator<I> && WeakStrictOrdering<R, ValueType<I>>
+class loser_tree {
+  std::vector<std::pair<I, I>> runs_;
+  // losers_[0] is the overall winner, the rest are internal nodes,
+  // run i is a leaf leaves_ + i. Runs after the real ones are empty.
+  std::vector<std::size_t> losers_;
+  std::size_t leaves_;
+  R r_;
+
+ public:
+  // Expects at least one run.
+  template <typename IR>
+  loser_tree(IR f, IR l, R r) : r_(r) {
+    for (; f != l; ++f) runs_.emplace_back(std::begin(*f), std::end(*f));
+
+    leaves_ = 1;
+    while (leaves_ < runs_.size()) leaves_ *= 2;
+    runs_.resize(leaves_, std::pair{runs_[0].second, runs_[0].second});
+
+    std::vector<std::size_t> winners(2 * leaves_);
+    for (std::size_t i = 0; i != leaves_; ++i) winners[leaves_ + i] = i;
+
+    losers_.resize(leaves_);
+    for (std::size_t node = leaves_ - 1; node; --node) {
+      std::size_t x = winners[2 * node];
+      std::size_t y = winners[2 * node + 1];
+      if (goes_before(y, x)) std::swap(x, y);
+      winners[node] = x;
+      losers_[node] = y;
+    }
+    losers_[0] = winners[1];
+  }
+
+  bool empty(std::size_t run) const {
+    return runs_[run].first == runs_[run].second;
+  }
+
+  // Empty runs lose to everything, equal elements are taken
+  // from the run that comes first.
+  bool goes_before(std::size_t x, std::size_t y) const {
+    if (empty(x)) return false;
+    if (empty(y)) return true;
+    if (x < y) return !r_(*runs_[y].first, *runs_[x].first);
+    return r_(*runs_[x].first, *runs_[y].first);
+  }
+
+  std::size_t winner() const { return losers_[0]; }
+
+  std::pair<I, I>& run(std::size_t i) { return runs_[i]; }
+
+  // Best of the runs that lost to the winner directly.
+  std::size_t runner_up() const {
+    std::size_t node = (leaves_ + winner()) / 2;
+    std::size_t res = losers_[node];
+    for (node /= 2; node; node /= 2) {
+      if (goes_before(losers_[node], res)) res = losers_[node];
+    }
+    return res;
+  }
+
+  // Has to be called after the winner's run has been advanced.
+  void replay() {
+    std::size_t x = winner();
+    for (std::size_t node = (leaves_ + x) / 2; node; node /= 2) {
+      if (goes_before(losers_[node], x)) std::swap(losers_[node], x);
+    }
+    losers_[0] = x;
+  }
+};
+
+}  // namespace detail
+
+template <typename IR, typename O, typename R>
+// require ForwardIterator<IR> && ForwardRange<ValueType<IR>>
+//         && OutputIterator<O> && WeakStrictOrdering<R, ValueType<range>>
+O merge_k(IR f, IR l, O o, R r) {
+  using I = decltype(std::begin(*f));
+
+  if (f == l) return o;
+  if (std::next(f) == l) return algo::copy(std::begin(*f), std::end(*f), o);
+
+  detail::loser_tree<I, R> tree(f, l, r);
+
+  std::size_t last = tree.winner();
+  std::size_t streak = 0;
+
+  while (!tree.empty(tree.winner())) {
+    const std::size_t w = tree.winner();
+    auto& [run_f, run_l] = tree.run(w);
+
+    streak = w == last ? streak + 1 : 1;
+    last = w;
+
+    if (streak < merge_k_gallop_boundary) {
+      *o = *run_f;
+      ++o;
+      ++run_f;
+      tree.replay();
+      continue;
+    }
+
+    // One run keeps winning: find how far it is ahead of everybody else
+    // and copy all of it at once.
+    const std::size_t c = tree.runner_up();
+    I next = run_l;
+    if (!tree.empty(c)) {
+      const auto& head = *tree.run(c).first;
+      next = w < c ? algo::partition_point_biased(
+                         run_f, run_l,
+                         [&](Reference<I> x) { return !r(head, x); })
+                   : algo::partition_point_biased(
+                         run_f, run_l,
+                         [&](Reference<I> x) { return r(x, head); });
+    }
+    o = algo::copy(run_f, next, o);
+    run_f = next;
+    streak = 0;
+    tree.replay();
+  }
+
+  return o;
+}
+
+template <typename IR, typename O>
+O merge_k(IR f, IR l, O o) {
+  return algo::merge_k(f, l, o, std::less<>{});
+}
+
+}  // namespace algo
+
+#endif  // ALGO_MERGE_K_H
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_PARALLEL_APPLY_REARRANGEMENT_H
+#define ALGO_PARALLEL_APPLY_REARRANGEMENT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include "algo/apply_rearrangment.h"
+#include "algo/half_nonnegative.h"
+#include "algo/move.h"
+#include "algo/scratch_arena.h"
+#include "algo/type_functions.h"
+#include "algo/work_stealing_pool.h"
+
+namespace algo {
+
+inline static constexpr std::ptrdiff_t
+    parallel_apply_rearrangment_sequential_boundary = 1 << 14;
+
+namespace detail {
+
+template <typename N, typename Op>
+// require Integer<N> && Callable<Op, N, N>
+void parallel_for_chunks(N f, N l, N grain, work_stealing_pool& pool, Op op) {
+  if (l - f <= grain) {
+    op(f, l);
+    return;
+  }
+
+  const N m = f + algo::half_nonnegative(l - f);
+  pool.fork_join([&] { parallel_for_chunks(f, m, grain, pool, op); },
+                 [&] { parallel_for_chunks(m, l, grain, pool, op); });
+}
+
+}  // namespace detail
+
+template <typename II>
+// require RandomAccessIterator<II> && Position<ValueType<II>
+void parallel_apply_rearrangment(II f, II l, ValueType<II> base,
+                                 ValueType<II> marker,
+                                 work_stealing_pool& pool) {
+  using I = ValueType<II>;
+  using T = ValueType<I>;
+  using N = DifferenceType<II>;
+
+  const N n = l - f;
+  if constexpr (RandomAccessIterator<I> &&
+                std::is_nothrow_move_constructible_v<T>) {
+    if (pool.size() > 1 &&
+        n > N(parallel_apply_rearrangment_sequential_boundary)) {
+      // Cycles are disjoint, but a random permutation is mostly one huge
+      // cycle, so there is not much to split between threads.
+      // Instead every thread gathers a chunk of the result into a buffer
+      // (loads don't depend on each other) and then moves it back.
+      // Positions are not modified.
+      // The buffer is not initialized: each chunk is constructed and
+      // destroyed by the thread that works on it.
+      scratch_arena arena;
+      T* buf = arena.reserve<T>(static_cast<std::size_t>(n));
+      const N grain =
+          std::max(N(parallel_apply_rearrangment_sequential_boundary),
+                   n / N(8 * pool.size()));
+
+      detail::parallel_for_chunks(N(0), n, grain, pool, [&](N from, N to) {
+        T* o = buf + from;
+        for (II i = f + from; i != f + to; ++i, ++o) {
+          ::new (static_cast<void*>(o)) T(std::move(**i));
+        }
+      });
+      detail::parallel_for_chunks(N(0), n, grain, pool, [&](N from, N to) {
+        algo::move(buf + from, buf + to, base + from);
+        std::destroy(buf + from, buf + to);
+      });
+      return;
+    }
+  }
+
+  algo::apply_rearrangment(f, l, base, marker);
+}
+
+}  // namespace algo
+
+#endif  // ALGO_PARALLEL_APPLY_REARRANGEMENT_H
@@ -0,0 +1,171 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_PARALLEL_MERGE_H
+#define ALGO_PARALLEL_MERGE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
+#include "algo/half_nonnegative.h"
+#include "algo/merge.h"
+#include "algo/merge_biased.h"
+#include "algo/type_functions.h"
+#include "algo/work_stealing_pool.h"
+
+namespace algo {
+
+inline static constexpr std::ptrdiff_t parallel_merge_sequential_boundary =
+    1 << 14;
+
+namespace detail {
+
+// Merge path: "Merge Path - Parallel Merging Made Simple",
+// Odeh, Green, Mwassi, Shmueli, Birk.
+//
+// How many of the first diag elements of the stable merge come from
+// the first range. Looks along the diagonal i + j == diag: x1[i] goes before
+// x2[diag - 1 - i] while !r(x2[diag - 1 - i], x1[i]), which is true for
+// small i and false after the crossing.
+template <typename I1, typename I2, typename R>
+// require RandomAccessIterator<I1, I2> && Mergeable<I1, I2, R>
+DifferenceType<I1> merge_path_split(I1 f1, DifferenceType<I1> n1, I2 f2,
+                                    DifferenceType<I1> n2,
+                                    DifferenceType<I1> diag, R r) {
+  DifferenceType<I1> lo = diag > n2 ? diag - n2 : 0;
+  DifferenceType<I1> n = std::min(diag, n1) - lo;
+
+  // partition_point_n over the diagonal: the predicate needs both ranges.
+  while (n) {
+    DifferenceType<I1> half = algo::half_nonnegative(n);
+    DifferenceType<I1> i = lo + half;
+    if (!r(*(f2 + (diag - 1 - i)), *(f1 + i))) {
+      lo = i + 1;
+      n -= half + 1;
+    } else {
+      n = half;
+    }
+  }
+  return lo;
+}
+
+// Chunks [chunk_f, chunk_l) out of chunks equal parts of the output.
+// Every chunk finds its own boundaries, so there is no sequential step.
+template <typename I1, typename I2, typename O, typename R, typename Merger>
+void parallel_merge_chunks(I1 f1, DifferenceType<I1> n1, I2 f2,
+                           DifferenceType<I1> n2, O o, R r,
+                           work_stealing_pool& pool, Merger merger,
+                           DifferenceType<I1> chunk_f,
+                           DifferenceType<I1> chunk_l,
+                           DifferenceType<I1> chunks) {
+  if (chunk_l - chunk_f == 1) {
+    const DifferenceType<I1> diag_f = (n1 + n2) * chunk_f / chunks;
+    const DifferenceType<I1> diag_l = (n1 + n2) * chunk_l / chunks;
+
+    const DifferenceType<I1> i_f = merge_path_split(f1, n1, f2, n2, diag_f, r);
+    const DifferenceType<I1> i_l = merge_path_split(f1, n1, f2, n2, diag_l, r);
+
+    merger(f1 + i_f, f1 + i_l, f2 + (diag_f - i_f), f2 + (diag_l - i_l),
+           o + diag_f, r);
+    return;
+  }
+
+  const DifferenceType<I1> chunk_m =
+      chunk_f + algo::half_nonnegative(chunk_l - chunk_f);
+  pool.fork_join(
+      [&] {
+        parallel_merge_chunks(f1, n1, f2, n2, o, r, pool, merger, chunk_f,
+                              chunk_m, chunks);
+      },
+      [&] {
+        parallel_merge_chunks(f1, n1, f2, n2, o, r, pool, merger, chunk_m,
+                              chunk_l, chunks);
+      });
+}
+
+template <typename I1, typename I2, typename O, typename R, typename Merger>
+// require Mergeable<I1, I2, O, R> && RandomAccessIterator<I1, I2, O>
+O parallel_merge_impl(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r,
+                      work_stealing_pool& pool, Merger merger) {
+  const DifferenceType<I1> n1 = l1 - f1;
+  const DifferenceType<I1> n2 = l2 - f2;
+
+  // One chunk per thread: merge path chunks are of the same size,
+  // so there is nothing to balance.
+  const DifferenceType<I1> chunks =
+      std::min(DifferenceType<I1>(pool.size()),
+               (n1 + n2) / DifferenceType<I1>(
+                               parallel_merge_sequential_boundary));
+
+  if (chunks <= 1) return merger(f1, l1, f2, l2, o, r);
+
+  parallel_merge_chunks(f1, n1, f2, n2, o, r, pool, merger,
+                        DifferenceType<I1>(0), chunks, chunks);
+  return o + (n1 + n2);
+}
+
+}  // namespace detail
+
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R> && RandomAccessIterator<I1, I2, O>
+O parallel_merge(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r,
+                 work_stealing_pool& pool) {
+  return detail::parallel_merge_impl(
+      f1, l1, f2, l2, o, r, pool,
+      [](auto... args) { return algo::merge(args...); });
+}
+
+template <typename I1, typename I2, typename O>
+O parallel_merge(I1 f1, I1 l1, I2 f2, I2 l2, O o, work_stealing_pool& pool) {
+  return algo::parallel_merge(f1, l1, f2, l2, o, std::less<>{}, pool);
+}
+
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R> && RandomAccessIterator<I1, I2, O>
+O parallel_merge_biased_first(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r,
+                              work_stealing_pool& pool) {
+  return detail::parallel_merge_impl(
+      f1, l1, f2, l2, o, r, pool,
+      [](auto... args) { return algo::merge_biased_first(args...); });
+}
+
+template <typename I1, typename I2, typename O>
+O parallel_merge_biased_first(I1 f1, I1 l1, I2 f2, I2 l2, O o,
+                              work_stealing_pool& pool) {
+  return algo::parallel_merge_biased_first(f1, l1, f2, l2, o, std::less<>{},
+                                           pool);
+}
+
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R> && RandomAccessIterator<I1, I2, O>
+O parallel_merge_biased_second(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r,
+                               work_stealing_pool& pool) {
+  return detail::parallel_merge_impl(
+      f1, l1, f2, l2, o, r, pool,
+      [](auto... args) { return algo::merge_biased_second(args...); });
+}
+
+template <typename I1, typename I2, typename O>
+O parallel_merge_biased_second(I1 f1, I1 l1, I2 f2, I2 l2, O o,
+                               work_stealing_pool& pool) {
+  return algo::parallel_merge_biased_second(f1, l1, f2, l2, o, std::less<>{},
+                                            pool);
+}
+
+}  // namespace algo
+
+#endif  // ALGO_PARALLEL_MERGE_H
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_PARALLEL_STABLE_SORT_H
+#define ALGO_PARALLEL_STABLE_SORT_H
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include "algo/binary_search.h"
+#include "algo/half_nonnegative.h"
+#include "algo/merge.h"
+#include "algo/move.h"
+#include "algo/stable_sort.h"
+#include "algo/type_functions.h"
+#include "algo/work_stealing_pool.h"
+
+namespace algo {
+
+inline static constexpr int parallel_stable_sort_sequential_boundary = 1 << 12;
+
+namespace detail {
+
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R> && RandomAccessIterator<I1, I2, O>
+void parallel_merge_halving(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r,
+                            work_stealing_pool& pool,
+                            DifferenceType<O> grain) {
+  const auto n1 = l1 - f1;
+  const auto n2 = l2 - f2;
+
+  if (n1 + n2 <= grain) {
+    algo::merge(f1, l1, f2, l2, o, r);
+    return;
+  }
+
+  // Split the bigger range in half and find the matching point in the other
+  // one. Equal elements from the first range always go to the left part.
+  I1 m1;
+  I2 m2;
+  if (n1 >= n2) {
+    m1 = f1 + algo::half_nonnegative(n1);
+    m2 = algo::lower_bound(f2, l2, *m1, r);
+  } else {
+    m2 = f2 + algo::half_nonnegative(n2);
+    m1 = algo::partition_point(f1, l1,
+                               [&](Reference<I1> x) { return !r(*m2, x); });
+  }
+  O mo = o + ((m1 - f1) + (m2 - f2));
+
+  pool.fork_join(
+      [&] { parallel_merge_halving(f1, m1, f2, m2, o, r, pool, grain); },
+      [&] { parallel_merge_halving(m1, l1, m2, l2, mo, r, pool, grain); });
+}
+
+template <typename I, typename N, typename R, typename B>
+void parallel_stable_sort_to_buffer(I f, N n, R r, B buf,
+                                    work_stealing_pool& pool, N grain);
+
+// The result is in [f, f + n), buf is a scratch space of size n.
+template <typename I, typename N, typename R, typename B>
+void parallel_stable_sort_in_place(I f, N n, R r, B buf,
+                                   work_stealing_pool& pool, N grain) {
+  if (n <= grain) {
+    algo::stable_sort_n_buffered(f, n, r, buf);
+    return;
+  }
+
+  N half = algo::half_nonnegative(n);
+  pool.fork_join(
+      [&] { parallel_stable_sort_to_buffer(f, half, r, buf, pool, grain); },
+      [&] {
+        parallel_stable_sort_to_buffer(f + half, n - half, r, buf + half, pool,
+                                       grain);
+      });
+
+  using MB = std::move_iterator<B>;
+  parallel_merge_halving(MB(buf), MB(buf + half), MB(buf + half), MB(buf + n),
+                         f, r, pool, DifferenceType<I>(grain));
+}
+
+// The result is in [buf, buf + n), [f, f + n) is a scratch space.
+template <typename I, typename N, typename R, typename B>
+void parallel_stable_sort_to_buffer(I f, N n, R r, B buf,
+                                    work_stealing_pool& pool, N grain) {
+  if (n <= grain) {
+    algo::move_n(f, n, buf);
+    algo::stable_sort_n_buffered(buf, n, r, f);
+    return;
+  }
+
+  N half = algo::half_nonnegative(n);
+  pool.fork_join(
+      [&] { parallel_stable_sort_in_place(f, half, r, buf, pool, grain); },
+      [&] {
+        parallel_stable_sort_in_place(f + half, n - half, r, buf + half, pool,
+                                      grain);
+      });
+
+  using MI = std::move_iterator<I>;
+  parallel_merge_halving(MI(f), MI(f + half), MI(f + half), MI(f + n), buf, r,
+                         pool, DifferenceType<B>(grain));
+}
+
+}  // namespace detail
+
+template <typename I, typename N, typename R, typename B>
+// require RandomAccessIterator<I> && Number<N> && RandomAccessIterator<B>
+//         && WeakStrictOrdering<R, ValueType<I>>
+void parallel_stable_sort_n_buffered(I f, N n, R r, B buf,
+                                     work_stealing_pool& pool) {
+  // Unlike stable_sort_n_buffered, buf has to fit all n elements:
+  // the top level merge is parallel and cannot write over its input.
+  N grain = std::max(N(parallel_stable_sort_sequential_boundary),
+                     n / N(8 * pool.size()));
+  detail::parallel_stable_sort_in_place(f, n, r, buf, pool, grain);
+}
+
+template <typename I, typename R>
+// require RandomAccessIterator<I> && WeakStrictOrdering<R, ValueType<I>>
+void parallel_stable_sort(I f, I l, R r, work_stealing_pool& pool) {
+  DifferenceType<I> n = l - f;
+  if (pool.size() == 1 ||
+      n <= DifferenceType<I>(parallel_stable_sort_sequential_boundary)) {
+    algo::stable_sort_sufficient_allocation(f, l, r);
+    return;
+  }
+
+  std::vector<ValueType<I>> buf(n);
+  algo::parallel_stable_sort_n_buffered(f, n, r, buf.begin(), pool);
+}
+
+template <typename I>
+void parallel_stable_sort(I f, I l, work_stealing_pool& pool) {
+  algo::parallel_stable_sort(f, l, std::less<>{}, pool);
+}
+
+}  // namespace algo
+
+#endif  // ALGO_PARALLEL_STABLE_SORT_H
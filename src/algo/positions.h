@@ -18,7 +18,9 @@
 #define ALGO_POSITIONS_H
 
 #include <algorithm>
+#include <cstdint>
 #include <iterator>
+#include <limits>
 #include <numeric>
 #include <utility>
 #include <vector>
@@ -112,6 +114,37 @@ template <typename I>
 using lifted_iterator = std::conditional_t<RandomAccessIterator<I>, I,
                                            detail::iterator_with_number<I>>;
 
+template <typename I, typename O>
+struct lift_result_type {
+  using position = algo::lifted_iterator<I>;
+
+  O positions_l;
+  position base;
+  position marker;
+};
+
+template <typename I, typename O>
+// require ForwardIterator<I> && OutputIterator<O>
+lift_result_type<I, O> lift(I f, I l, O o) {
+  DifferenceType<I> n(0);
+  auto make_position = [&] {
+    if constexpr (RandomAccessIterator<I>) {
+      return f;
+    } else {
+      return lifted_iterator<I>(f, n);
+    }
+  };
+
+  lifted_iterator<I> base = make_position();
+  while (f != l) {
+    *o = make_position();
+    ++o;
+    ++f;
+    ++n;
+  }
+  return {o, base, make_position()};
+}
+
 template <typename I>
 struct lift_as_vector_result_type {
   using position = algo::lifted_iterator<I>;
@@ -140,6 +173,47 @@ lift_as_vector_result_type<I> lift_as_vector(I f, I l) {
   }
 }
 
+// Index positions: offsets from the beginning of a random access range
+// instead of iterators. The biggest index is reserved for the marker.
+
+template <typename N>
+inline constexpr N index_marker = std::numeric_limits<N>::max();
+
+template <typename N, typename D>
+// require UnsignedInteger<N> && Integer<D>
+constexpr bool fits_indices(D n) {
+  return static_cast<std::uint64_t>(n) < index_marker<N>;
+}
+
+template <typename N>
+struct lift_as_indices_result_type {
+  std::vector<N> positions;
+  N marker;
+};
+
+template <typename N, typename I>
+// require UnsignedInteger<N> && RandomAccessIterator<I>
+lift_as_indices_result_type<N> lift_as_indices(I f, I l) {
+  // precondition: fits_indices<N>(l - f)
+  std::vector<N> positions(static_cast<std::size_t>(l - f));
+  std::iota(positions.begin(), positions.end(), N(0));
+  return {std::move(positions), index_marker<N>};
+}
+
+// Calls op with lift_as_indices for the smallest of
+// std::uint32_t/std::uint64_t that fits the range.
+template <typename I, typename Op>
+// require RandomAccessIterator<I> &&
+//         Callable<Op, lift_as_indices_result_type<std::uint32_t>> &&
+//         Callable<Op, lift_as_indices_result_type<std::uint64_t>>
+void with_lifted_indices(I f, I l, Op op) {
+  if (fits_indices<std::uint32_t>(l - f)) {
+    op(lift_as_indices<std::uint32_t>(f, l));
+  } else {
+    op(lift_as_indices<std::uint64_t>(f, l));
+  }
+}
+
 }  // namespace algo
 
 #endif  // ALGO_POSITIONS_H
@@ -0,0 +1,196 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_RADIX_STABLE_SORT_H
+#define ALGO_RADIX_STABLE_SORT_H
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "algo/half_nonnegative.h"
+#include "algo/merge.h"
+#include "algo/move.h"
+#include "algo/type_functions.h"
+#include "algo/uint_tuple.h"
+
+namespace algo {
+namespace detail {
+
+template <typename T>
+struct radix_key_t {
+  static_assert(std::is_integral_v<T> || std::is_floating_point_v<T>,
+                "unsupported key type");
+
+  constexpr auto operator()(T x) const {
+    using U = uint_t<bit_size<T>()>;
+
+    if constexpr (std::is_floating_point_v<T>) {
+      if (x == T(0)) x = T(0);  // -0.0 and 0.0 should be one key
+      U bits;
+      std::memcpy(&bits, &x, sizeof(x));
+      constexpr U sign_bit = U(1) << (bit_size<T>() - 1);
+      return (bits & sign_bit) ? U(~bits) : U(bits | sign_bit);
+    } else if constexpr (std::is_signed_v<T>) {
+      constexpr U sign_bit = U(1) << (bit_size<T>() - 1);
+      return U(static_cast<U>(x) ^ sign_bit);
+    } else {
+      return static_cast<U>(x);
+    }
+  }
+};
+
+template <size_t... sizes>
+struct radix_key_t<uint_tuple<sizes...>> {
+  constexpr auto operator()(uint_tuple<sizes...> x) const { return x.data; }
+};
+
+template <typename T, typename U>
+struct radix_key_t<std::pair<T, U>> {
+  constexpr auto operator()(const std::pair<T, U>& x) const {
+    auto first = radix_key_t<T>{}(x.first);
+    auto second = radix_key_t<U>{}(x.second);
+    using res_t = uint_t<bit_size<decltype(first)>() +
+                         bit_size<decltype(second)>()>;
+    return res_t((res_t(first) << bit_size<decltype(second)>()) | second);
+  }
+};
+
+// Maps a key to an unsigned number, such that comparing numbers gives
+// the same result as comparing keys with operator<.
+template <typename T>
+constexpr auto radix_key(const T& x) {
+  return radix_key_t<T>{}(x);
+}
+
+struct radix_identity {
+  template <typename T>
+  constexpr const T& operator()(const T& x) const {
+    return x;
+  }
+};
+
+inline static constexpr std::size_t radix_digit_bits = 8;
+inline static constexpr std::size_t radix_digit_values = 1 << radix_digit_bits;
+
+template <typename U>
+constexpr std::size_t radix_digit(U x, std::size_t d) {
+  return static_cast<std::size_t>(x >> (d * radix_digit_bits)) &
+         (radix_digit_values - 1);
+}
+
+template <typename I, typename N, typename O, typename K>
+// require RandomAccessIterator<I> && Number<N> && RandomAccessIterator<O>
+void radix_scatter_n(I f, N n, O o, K key, std::size_t d,
+                     std::array<N, radix_digit_values>& offsets) {
+  for (; n; --n, ++f) {
+    N& pos = offsets[radix_digit(radix_key(key(*f)), d)];
+    o[pos] = std::move(*f);
+    ++pos;
+  }
+}
+
+}  // namespace detail
+
+template <typename I, typename N, typename K, typename B>
+// require RandomAccessIterator<I> && Number<N> && RandomAccessIterator<B>
+//         && KeyExtractor<K, ValueType<I>>
+I lsd_radix_sort_n_buffered(I f, N n, K key, B buf) {
+  // buf has to fit all n elements.
+  using U = decltype(detail::radix_key(key(*f)));
+  constexpr std::size_t digits = bit_size<U>() / detail::radix_digit_bits;
+
+  // All of the histograms are computed in one pass.
+  std::array<std::array<N, detail::radix_digit_values>, digits> counts{};
+  I l = f;
+  for (N i = n; i; --i, ++l) {
+    const U x = detail::radix_key(key(*l));
+    for (std::size_t d = 0; d != digits; ++d) {
+      ++counts[d][detail::radix_digit(x, d)];
+    }
+  }
+  if (n < N(2)) return l;
+
+  bool in_buffer = false;
+  const U first_key = detail::radix_key(key(*f));
+
+  for (std::size_t d = 0; d != digits; ++d) {
+    auto& offsets = counts[d];
+
+    // Every element has the same digit.
+    if (offsets[detail::radix_digit(first_key, d)] == n) continue;
+
+    N sum = 0;
+    for (N& offset : offsets) {
+      N count = offset;
+      offset = sum;
+      sum += count;
+    }
+
+    if (in_buffer) {
+      detail::radix_scatter_n(buf, n, f, key, d, offsets);
+    } else {
+      detail::radix_scatter_n(f, n, buf, key, d, offsets);
+    }
+    in_buffer = !in_buffer;
+  }
+
+  if (in_buffer) algo::move_n(buf, n, f);
+  return l;
+}
+
+template <typename I, typename N, typename K, typename B>
+// require RandomAccessIterator<I> && Number<N> && RandomAccessIterator<B>
+//         && KeyExtractor<K, ValueType<I>>
+I radix_stable_sort_n_buffered(I f, N n, K key, B buf) {
+  // Same as stable_sort_n_buffered: buf has to fit ceil(n / 2) elements,
+  // both halves are sorted with radix sort and then merged.
+  N half = algo::half_nonnegative(n);
+  I m = algo::lsd_radix_sort_n_buffered(f, half, key, buf);
+  I l = algo::lsd_radix_sort_n_buffered(m, n - half, key, buf);
+
+  auto less = [&](const auto& x, const auto& y) {
+    return detail::radix_key(key(x)) < detail::radix_key(key(y));
+  };
+  if (half == 0 || !less(*m, *(m - 1))) return l;
+
+  B buf_l = algo::move_n(f, half, buf).second;
+
+  using MI = std::move_iterator<I>;
+  using MB = std::move_iterator<B>;
+  return algo::merge(MB(buf), MB(buf_l), MI(m), MI(l), f, less);
+}
+
+template <typename I, typename K>
+// require RandomAccessIterator<I> && KeyExtractor<K, ValueType<I>>
+void radix_stable_sort(I f, I l, K key) {
+  DifferenceType<I> n = l - f;
+  std::vector<ValueType<I>> buf(n - algo::half_nonnegative(n));
+  algo::radix_stable_sort_n_buffered(f, n, key, buf.begin());
+}
+
+template <typename I>
+void radix_stable_sort(I f, I l) {
+  algo::radix_stable_sort(f, l, detail::radix_identity{});
+}
+
+}  // namespace algo
+
+#endif  // ALGO_RADIX_STABLE_SORT_H
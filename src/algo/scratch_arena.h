@@ -0,0 +1,98 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_SCRATCH_ARENA_H
+#define ALGO_SCRATCH_ARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace algo {
+
+inline static constexpr std::size_t scratch_arena_alignment = 64;
+
+// Untyped memory that only grows. Every reserve invalidates the previous one.
+class scratch_arena {
+  struct deleter {
+    void operator()(std::byte* p) const {
+      ::operator delete(p, std::align_val_t{scratch_arena_alignment});
+    }
+  };
+
+  std::unique_ptr<std::byte, deleter> data_;
+  std::size_t capacity_ = 0;
+
+ public:
+  scratch_arena() = default;
+  scratch_arena(scratch_arena&&) = default;
+  scratch_arena& operator=(scratch_arena&&) = default;
+
+  // Uninitialized memory for n elements of U.
+  template <typename U>
+  U* reserve(std::size_t n) {
+    static_assert(alignof(U) <= scratch_arena_alignment);
+
+    const std::size_t bytes = n * sizeof(U);
+    if (bytes > capacity_) {
+      std::size_t new_capacity = std::max(bytes, capacity_ * 2);
+      new_capacity = (new_capacity + scratch_arena_alignment - 1) /
+                     scratch_arena_alignment * scratch_arena_alignment;
+
+      data_.reset();
+      capacity_ = 0;
+      data_.reset(static_cast<std::byte*>(::operator new(
+          new_capacity, std::align_val_t{scratch_arena_alignment})));
+      capacity_ = new_capacity;
+    }
+    return reinterpret_cast<U*>(data_.get());
+  }
+
+  std::size_t capacity() const { return capacity_; }
+
+  void release() {
+    data_.reset();
+    capacity_ = 0;
+  }
+};
+
+// n default constructed elements of U that live in the arena
+// until the scratch_buffer is destroyed.
+template <typename U>
+class scratch_buffer {
+  U* f_;
+  std::size_t n_;
+
+ public:
+  scratch_buffer(scratch_arena& arena, std::size_t n)
+      : f_(arena.reserve<U>(n)), n_(n) {
+    std::uninitialized_default_construct_n(f_, n_);
+  }
+
+  scratch_buffer(const scratch_buffer&) = delete;
+  scratch_buffer& operator=(const scratch_buffer&) = delete;
+
+  ~scratch_buffer() { std::destroy_n(f_, n_); }
+
+  U* begin() const { return f_; }
+  U* end() const { return f_ + n_; }
+  std::size_t size() const { return n_; }
+};
+
+}  // namespace algo
+
+#endif  // ALGO_SCRATCH_ARENA_H
@@ -0,0 +1,158 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_SET_OPERATIONS_H
+#define ALGO_SET_OPERATIONS_H
+
+#include <functional>
+
+#include "algo/copy.h"
+#include "algo/type_functions.h"
+
+namespace algo {
+
+// Same semantics as std::set_* algorithms: for an element that appears
+// m times in the first range and n times in the second, the result has
+// it max(m, n) times for union, min(m, n) for intersection,
+// max(m - n, 0) for difference and |m - n| for symmetric difference.
+// Equal elements are taken from the first range when possible.
+
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R>
+O set_union(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r) {
+  if (f1 == l1) goto copySecond;
+  if (f2 == l2) goto copyFirst;
+
+  // clang-format off
+  while (true) {
+    if (r(*f2, *f1)) {
+      *o = *f2; ++o; ++f2; if (f2 == l2) goto copyFirst;
+      continue;
+    }
+    if (r(*f1, *f2)) {
+      *o = *f1; ++o; ++f1; if (f1 == l1) goto copySecond;
+      continue;
+    }
+    *o = *f1; ++o; ++f1; ++f2;
+    if (f1 == l1) goto copySecond;
+    if (f2 == l2) goto copyFirst;
+  }
+  // clang-format on
+
+copySecond:
+  return algo::copy(f2, l2, o);
+copyFirst:
+  return algo::copy(f1, l1, o);
+}
+
+template <typename I1, typename I2, typename O>
+O set_union(I1 f1, I1 l1, I2 f2, I2 l2, O o) {
+  return algo::set_union(f1, l1, f2, l2, o, std::less<>{});
+}
+
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R>
+O set_intersection(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r) {
+  if (f1 == l1 || f2 == l2) return o;
+
+  // clang-format off
+  while (true) {
+    if (r(*f1, *f2)) {
+      ++f1; if (f1 == l1) return o;
+      continue;
+    }
+    if (r(*f2, *f1)) {
+      ++f2; if (f2 == l2) return o;
+      continue;
+    }
+    *o = *f1; ++o; ++f1; ++f2;
+    if (f1 == l1 || f2 == l2) return o;
+  }
+  // clang-format on
+}
+
+template <typename I1, typename I2, typename O>
+O set_intersection(I1 f1, I1 l1, I2 f2, I2 l2, O o) {
+  return algo::set_intersection(f1, l1, f2, l2, o, std::less<>{});
+}
+
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R>
+O set_difference(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r) {
+  if (f1 == l1) return o;
+  if (f2 == l2) goto copyFirst;
+
+  // clang-format off
+  while (true) {
+    if (r(*f1, *f2)) {
+      *o = *f1; ++o; ++f1; if (f1 == l1) return o;
+      continue;
+    }
+    if (r(*f2, *f1)) {
+      ++f2; if (f2 == l2) goto copyFirst;
+      continue;
+    }
+    ++f1; ++f2;
+    if (f1 == l1) return o;
+    if (f2 == l2) goto copyFirst;
+  }
+  // clang-format on
+
+copyFirst:
+  return algo::copy(f1, l1, o);
+}
+
+template <typename I1, typename I2, typename O>
+O set_difference(I1 f1, I1 l1, I2 f2, I2 l2, O o) {
+  return algo::set_difference(f1, l1, f2, l2, o, std::less<>{});
+}
+
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R>
+O set_symmetric_difference(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r) {
+  if (f1 == l1) goto copySecond;
+  if (f2 == l2) goto copyFirst;
+
+  // clang-format off
+  while (true) {
+    if (r(*f2, *f1)) {
+      *o = *f2; ++o; ++f2; if (f2 == l2) goto copyFirst;
+      continue;
+    }
+    if (r(*f1, *f2)) {
+      *o = *f1; ++o; ++f1; if (f1 == l1) goto copySecond;
+      continue;
+    }
+    ++f1; ++f2;
+    if (f1 == l1) goto copySecond;
+    if (f2 == l2) goto copyFirst;
+  }
+  // clang-format on
+
+copySecond:
+  return algo::copy(f2, l2, o);
+copyFirst:
+  return algo::copy(f1, l1, o);
+}
+
+template <typename I1, typename I2, typename O>
+O set_symmetric_difference(I1 f1, I1 l1, I2 f2, I2 l2, O o) {
+  return algo::set_symmetric_difference(f1, l1, f2, l2, o, std::less<>{});
+}
+
+}  // namespace algo
+
+#endif  // ALGO_SET_OPERATIONS_H
@@ -0,0 +1,244 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_SET_OPERATIONS_SIMD_H
+#define ALGO_SET_OPERATIONS_SIMD_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "algo/merge_bitonic.h"
+#include "algo/set_operations.h"
+#include "algo/sorting_network.h"
+#include "algo/type_functions.h"
+#include "simd/pack.h"
+
+namespace algo {
+namespace detail {
+
+template <typename I1, typename I2, typename R>
+constexpr bool set_operations_simd_applicable() {
+  using T = std::remove_const_t<ValueType<I1>>;
+  if constexpr (!sorting_network_supported_type<T>()) {
+    return false;
+  } else {
+    return merge_bitonic_contiguous<I1, T>() &&
+           merge_bitonic_contiguous<I2, T>() &&
+           (std::is_same_v<R, std::less<>> || std::is_same_v<R, std::less<T>>);
+  }
+}
+
+// Lanes of x that are equal to some lane of y: compare x with
+// every rotation of y.
+// Rotations are done on 32 bit halves: there is no 64 bit shuffle
+// for 256 bit registers.
+template <std::size_t k, typename Pack, typename Halves>
+simd::vbool_t<Pack> all_pairs_equal(const Pack& x, const Halves& y,
+                                    simd::vbool_t<Pack> res) {
+  constexpr std::size_t size = simd::size_v<Pack>;
+  if constexpr (k == size) {
+    return res;
+  } else {
+    constexpr std::size_t halves = simd::size_v<Halves>;
+    constexpr auto rotation = [] {
+      std::array<std::uint32_t, halves> idx{};
+      for (std::size_t i = 0; i != halves; ++i) {
+        idx[i] = (i + k * (halves / size)) % halves;
+      }
+      return idx;
+    }();
+    const Pack rotated = simd::cast<Pack>(simd::shuffle(y, rotation));
+    res |= simd::equal_pairwise(x, rotated);
+    return all_pairs_equal<k + 1>(x, y, res);
+  }
+}
+
+template <typename Pack>
+simd::vbool_t<Pack> all_pairs_equal(const Pack& x, const Pack& y) {
+  using halves_t = simd::pack<std::uint32_t, sizeof(Pack) / 4>;
+  return all_pairs_equal<1>(x, simd::cast<halves_t>(y),
+                            simd::equal_pairwise(x, y));
+}
+
+template <typename T, typename Vbool, typename O>
+O copy_selected_lanes(const T* f, const Vbool& selected, O o) {
+  for (auto i = simd::first_true(selected); i;
+       i = simd::first_true_ignore_first_n(selected, *i + 1)) {
+    *o = f[*i];
+    ++o;
+  }
+  return o;
+}
+
+// Intersection (keep_found) or difference (!keep_found) of the strictly
+// increasing ranges: elements of the first range are kept depending on
+// whether they are found in the second.
+// "Faster Set Intersection with SIMD instructions by Reducing Branch
+// Mispredictions", Inoue et al. and "SIMD Compression and the Intersection
+// of Sorted Integers", Lemire et al.
+template <bool keep_found, typename T, typename O>
+O set_filter_simd_impl(const T* f1, const T* l1, const T* f2, const T* l2,
+                       O o) {
+  using pack_t = sorting_network_pack<T>;
+  using vbool = simd::vbool_t<pack_t>;
+  constexpr std::ptrdiff_t size = simd::size_v<pack_t>;
+
+  // A block of the first range is compared with every block of the second
+  // range it overlaps and is written out once the second range passed it.
+  vbool found = simd::set_zero<vbool>();
+  while (l1 - f1 >= size && l2 - f2 >= size) {
+    const pack_t x = simd::load_unaligned<pack_t>(f1);
+    const pack_t y = simd::load_unaligned<pack_t>(f2);
+    found |= all_pairs_equal(x, y);
+
+    const T x_max = f1[size - 1];
+    const T y_max = f2[size - 1];
+    if (!(y_max < x_max)) {
+      o = copy_selected_lanes(f1, keep_found ? found : ~found, o);
+      found = simd::set_zero<vbool>();
+      f1 += size;
+    }
+    if (!(x_max < y_max)) f2 += size;
+  }
+
+  // The second range ran out in the middle of a block of the first one:
+  // part of the block might have been found already.
+  if (l1 - f1 >= size) {
+    std::array<simd::scalar_t<vbool>, size> found_lanes;
+    simd::store_unaligned(found_lanes.data(), found);
+
+    for (std::ptrdiff_t i = 0; i != size; ++i) {
+      const T x = f1[i];
+      while (f2 != l2 && *f2 < x) ++f2;
+      const bool is_found = found_lanes[i] || (f2 != l2 && *f2 == x);
+      if (is_found != keep_found) continue;
+      *o = x;
+      ++o;
+    }
+    f1 += size;
+  }
+
+  if constexpr (keep_found) {
+    return algo::set_intersection(f1, l1, f2, l2, o, std::less<>{});
+  } else {
+    return algo::set_difference(f1, l1, f2, l2, o, std::less<>{});
+  }
+}
+
+template <bool keep_found, typename I1, typename I2, typename O>
+O set_filter_simd(I1 f1, I1 l1, I2 f2, I2 l2, O o) {
+  if (f1 == l1) return o;
+  if (f2 == l2) {
+    if constexpr (keep_found) {
+      return o;
+    } else {
+      return algo::copy(f1, l1, o);
+    }
+  }
+  return set_filter_simd_impl<keep_found>(&*f1, &*f1 + (l1 - f1), &*f2,
+                                          &*f2 + (l2 - f2), o);
+}
+
+}  // namespace detail
+
+// SIMD versions of set operations from "algo/set_operations.h" for
+// 32/64 bit integers with std::less, in pointers or vector iterators
+// (everything else goes to the plain versions).
+// Unlike the plain versions, both ranges have to be strictly increasing
+// (sets, not multisets).
+
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R> && ForwardIterator<I1, I2>
+O set_intersection_simd(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r) {
+  if constexpr (detail::set_operations_simd_applicable<I1, I2, R>()) {
+    return detail::set_filter_simd<true>(f1, l1, f2, l2, o);
+  } else {
+    return algo::set_intersection(f1, l1, f2, l2, o, r);
+  }
+}
+
+template <typename I1, typename I2, typename O>
+O set_intersection_simd(I1 f1, I1 l1, I2 f2, I2 l2, O o) {
+  return algo::set_intersection_simd(f1, l1, f2, l2, o, std::less<>{});
+}
+
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R> && ForwardIterator<I1, I2>
+O set_difference_simd(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r) {
+  if constexpr (detail::set_operations_simd_applicable<I1, I2, R>()) {
+    return detail::set_filter_simd<false>(f1, l1, f2, l2, o);
+  } else {
+    return algo::set_difference(f1, l1, f2, l2, o, r);
+  }
+}
+
+template <typename I1, typename I2, typename O>
+O set_difference_simd(I1 f1, I1 l1, I2 f2, I2 l2, O o) {
+  return algo::set_difference_simd(f1, l1, f2, l2, o, std::less<>{});
+}
+
+// Union and symmetric difference are merges of differences,
+// the differences go to a temporary buffer.
+
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R> && ForwardIterator<I1, I2>
+O set_union_simd(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r) {
+  if constexpr (detail::set_operations_simd_applicable<I1, I2, R>()) {
+    std::vector<ValueType<I2>> only_second(l2 - f2);
+    auto only_second_l = detail::set_filter_simd<false>(
+        f2, l2, f1, l1, only_second.begin());
+    return algo::merge_bitonic(f1, l1, only_second.begin(), only_second_l,
+                               o, r);
+  } else {
+    return algo::set_union(f1, l1, f2, l2, o, r);
+  }
+}
+
+template <typename I1, typename I2, typename O>
+O set_union_simd(I1 f1, I1 l1, I2 f2, I2 l2, O o) {
+  return algo::set_union_simd(f1, l1, f2, l2, o, std::less<>{});
+}
+
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R> && ForwardIterator<I1, I2>
+O set_symmetric_difference_simd(I1 f1, I1 l1, I2 f2, I2 l2, O o, R r) {
+  if constexpr (detail::set_operations_simd_applicable<I1, I2, R>()) {
+    std::vector<ValueType<I1>> only_first(l1 - f1);
+    std::vector<ValueType<I2>> only_second(l2 - f2);
+    auto only_first_l =
+        detail::set_filter_simd<false>(f1, l1, f2, l2, only_first.begin());
+    auto only_second_l = detail::set_filter_simd<false>(
+        f2, l2, f1, l1, only_second.begin());
+    return algo::merge_bitonic(only_first.begin(), only_first_l,
+                               only_second.begin(), only_second_l, o, r);
+  } else {
+    return algo::set_symmetric_difference(f1, l1, f2, l2, o, r);
+  }
+}
+
+template <typename I1, typename I2, typename O>
+O set_symmetric_difference_simd(I1 f1, I1 l1, I2 f2, I2 l2, O o) {
+  return algo::set_symmetric_difference_simd(f1, l1, f2, l2, o,
+                                             std::less<>{});
+}
+
+}  // namespace algo
+
+#endif  // ALGO_SET_OPERATIONS_SIMD_H
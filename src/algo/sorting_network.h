@@ -0,0 +1,278 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_SORTING_NETWORK_H
+#define ALGO_SORTING_NETWORK_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "algo/comparisons.h"
+#include "algo/radix_stable_sort.h"
+#include "algo/type_functions.h"
+#include "simd/pack.h"
+
+namespace algo {
+
+inline static constexpr std::size_t sorting_network_max_size = 32;
+
+namespace detail {
+
+template <typename T>
+constexpr bool sorting_network_supported_type() {
+  return std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+         (sizeof(T) == 4 || sizeof(T) == 8);
+}
+
+template <typename T>
+using sorting_network_pack = simd::pack<T, 32 / sizeof(T)>;
+
+constexpr std::size_t sorting_network_highest_bit(std::size_t x) {
+  std::size_t res = 1;
+  while (x >>= 1) res <<= 1;
+  return res;
+}
+
+template <typename Pack>
+Pack sorting_network_reverse(const Pack& x) {
+  constexpr std::size_t size = simd::size_v<Pack>;
+  constexpr auto idx = [] {
+    std::array<std::uint32_t, size> res{};
+    for (std::size_t i = 0; i != size; ++i) res[i] = size - 1 - i;
+    return res;
+  }();
+  return simd::shuffle(x, idx);
+}
+
+// Compare exchange i with i ^ x, the smaller one goes to the smaller index.
+template <std::size_t x, typename Pack, std::size_t K>
+void sorting_network_step(std::array<Pack, K>& regs) {
+  constexpr std::size_t size = simd::size_v<Pack>;
+
+  if constexpr (x < size) {
+    constexpr auto idx = [] {
+      std::array<std::uint32_t, size> res{};
+      for (std::size_t i = 0; i != size; ++i) res[i] = i ^ x;
+      return res;
+    }();
+    constexpr auto take_max = [] {
+      std::array<bool, size> res{};
+      for (std::size_t i = 0; i != size; ++i) {
+        res[i] = i & sorting_network_highest_bit(x);
+      }
+      return res;
+    }();
+
+    const auto mask = simd::mask_from_bools<Pack>(take_max);
+    for (auto& reg : regs) {
+      Pack swapped = simd::shuffle(reg, idx);
+      reg = simd::blend(simd::min_pairwise(reg, swapped),
+                        simd::max_pairwise(reg, swapped), mask);
+    }
+  } else {
+    // x is either a multiple of size or a multiple of size + size - 1:
+    // in the second case lanes are paired in reverse.
+    constexpr std::size_t reg_x = x / size;
+    constexpr bool reverse = x % size != 0;
+
+    for (std::size_t r = 0; r != K; ++r) {
+      const std::size_t r2 = r ^ reg_x;
+      if (r2 < r) continue;
+
+      Pack y = regs[r2];
+      if constexpr (reverse) y = sorting_network_reverse(y);
+
+      Pack max = simd::max_pairwise(regs[r], y);
+      regs[r] = simd::min_pairwise(regs[r], y);
+
+      if constexpr (reverse) max = sorting_network_reverse(max);
+      regs[r2] = max;
+    }
+  }
+}
+
+template <std::size_t x, typename Pack, std::size_t K>
+void sorting_network_half_cleaners(std::array<Pack, K>& regs) {
+  if constexpr (x > 0) {
+    sorting_network_step<x>(regs);
+    sorting_network_half_cleaners<x / 2>(regs);
+  }
+}
+
+// Bitonic sort, merging blocks of size s at each stage. The first step of
+// the stage pairs the elements of the two halves in reverse (flip), so all
+// of the blocks are sorted in the same direction.
+template <std::size_t s, typename Pack, std::size_t K>
+void sorting_network_stages(std::array<Pack, K>& regs) {
+  if constexpr (s <= K * simd::size_v<Pack>) {
+    sorting_network_step<s - 1>(regs);
+    sorting_network_half_cleaners<s / 4>(regs);
+    sorting_network_stages<s * 2>(regs);
+  }
+}
+
+template <std::size_t N, typename T>
+void sort_network_aligned(T* f) {
+  using pack_t = sorting_network_pack<T>;
+  constexpr std::size_t K = N / simd::size_v<pack_t>;
+
+  std::array<pack_t, K> regs;
+  for (std::size_t i = 0; i != K; ++i) {
+    regs[i] = simd::load<pack_t>(f + i * simd::size_v<pack_t>);
+  }
+
+  sorting_network_stages<2>(regs);
+
+  for (std::size_t i = 0; i != K; ++i) {
+    simd::store(f + i * simd::size_v<pack_t>, regs[i]);
+  }
+}
+
+// Copies into the aligned buffer, pads with max and sorts the smallest network
+// that fits.
+template <typename I, typename N, typename T, typename Op>
+// require RandomAccessIterator<I> && Number<N> && Sortable<T>
+void sort_network_padded_n(I f, N n, T* buf, Op to_t) {
+  for (N i = 0; i != n; ++i) buf[i] = to_t(f[i], i);
+  for (std::size_t i = n; i < sorting_network_max_size; ++i) {
+    buf[i] = std::numeric_limits<T>::max();
+  }
+
+  if (n <= N(8)) {
+    sort_network_aligned<8>(buf);
+  } else if (n <= N(16)) {
+    sort_network_aligned<16>(buf);
+  } else {
+    sort_network_aligned<32>(buf);
+  }
+}
+
+}  // namespace detail
+
+// Sorts exactly N (8, 16 or 32) 32/64 bit integers.
+template <std::size_t N, typename T>
+void sort_network(T* f) {
+  static_assert(N == 8 || N == 16 || N == 32);
+  static_assert(detail::sorting_network_supported_type<T>());
+
+  using pack_t = detail::sorting_network_pack<T>;
+  constexpr std::size_t K = N / simd::size_v<pack_t>;
+
+  std::array<pack_t, K> regs;
+  for (std::size_t i = 0; i != K; ++i) {
+    regs[i] = simd::load_unaligned<pack_t>(f + i * simd::size_v<pack_t>);
+  }
+
+  detail::sorting_network_stages<2>(regs);
+
+  for (std::size_t i = 0; i != K; ++i) {
+    simd::store_unaligned(f + i * simd::size_v<pack_t>, regs[i]);
+  }
+}
+
+template <typename I, typename N>
+// require RandomAccessIterator<I> && Number<N>
+I sort_network_n(I f, N n) {
+  // n <= sorting_network_max_size
+  using T = ValueType<I>;
+  static_assert(detail::sorting_network_supported_type<T>());
+
+  alignas(32) std::array<T, sorting_network_max_size> buf;
+  detail::sort_network_padded_n(f, n, buf.data(),
+                                [](const T& x, N) { return x; });
+  for (N i = 0; i != n; ++i) f[i] = buf[i];
+  return f + n;
+}
+
+template <typename I, typename N>
+// require RandomAccessIterator<I> && Number<N>
+//         && ValueType<I> == std::pair<Key, Value>
+I stable_sort_network_by_first_n(I f, N n) {
+  // n <= sorting_network_max_size
+  //
+  // Keys are extended with the original position, so all of them are unique
+  // and the network (which is not stable) produces the stable order.
+  using key_t = decltype(ValueType<I>::first);
+  static_assert(std::is_integral_v<key_t> && sizeof(key_t) <= 4);
+
+  alignas(32) std::array<std::uint64_t, sorting_network_max_size> buf;
+  detail::sort_network_padded_n(
+      f, n, buf.data(), [](const ValueType<I>& x, N i) {
+        const std::uint64_t key = detail::radix_key(x.first);
+        return key << 32 | static_cast<std::uint64_t>(i);
+      });
+
+  // Position i has to get the element from buf[i] & 0xffffffff.
+  const auto from = [&](N i) { return static_cast<N>(buf[i] & 0xffffffff); };
+  std::uint32_t done = 0;
+  for (N i = 0; i != n; ++i) {
+    if (done & (std::uint32_t{1} << i)) continue;
+    if (from(i) == i) continue;
+
+    ValueType<I> tmp = std::move(f[i]);
+    N j = i;
+    for (N src = from(j); src != i; j = src, src = from(j)) {
+      f[j] = std::move(f[src]);
+      done |= std::uint32_t{1} << j;
+    }
+    f[j] = std::move(tmp);
+    done |= std::uint32_t{1} << j;
+  }
+
+  return f + n;
+}
+
+// Whether sort_network_n/stable_sort_network_by_first_n can replace
+// a stable sort of up to sorting_network_max_size elements.
+template <typename I, typename R>
+constexpr bool sorting_network_applicable() {
+  if constexpr (!RandomAccessIterator<I>) {
+    return false;
+  } else {
+    using T = ValueType<I>;
+    if constexpr (detail::sorting_network_supported_type<T>()) {
+      return std::is_same_v<R, std::less<>> || std::is_same_v<R, std::less<T>>;
+    } else if constexpr (std::is_same_v<R, less_by_first>) {
+      if constexpr (!std::is_class_v<T>) {
+        return false;
+      } else {
+        using key_t = std::decay_t<decltype(std::declval<T>().first)>;
+        return std::is_integral_v<key_t> && !std::is_same_v<key_t, bool> &&
+               sizeof(key_t) <= 4;
+      }
+    } else {
+      return false;
+    }
+  }
+}
+
+template <typename I, typename N, typename R>
+// require sorting_network_applicable<I, R>() && Number<N>
+I stable_sort_network_n(I f, N n, R) {
+  if constexpr (std::is_same_v<R, less_by_first>) {
+    return algo::stable_sort_network_by_first_n(f, n);
+  } else {
+    return algo::sort_network_n(f, n);
+  }
+}
+
+}  // namespace algo
+
+#endif  // ALGO_SORTING_NETWORK_H
@@ -17,22 +17,34 @@
 #ifndef ALGO_STABLE_SORT_H
 #define ALGO_STABLE_SORT_H
 
+#include <algorithm>
+#include <array>
 #include <iterator>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "algo/apply_rearrangment.h"
+#include "algo/binary_search.h"
+#include "algo/binary_search_biased.h"
 #include "algo/half_nonnegative.h"
+#include "algo/inplace_merge.h"
 #include "algo/merge.h"
+#include "algo/merge_biased.h"
 #include "algo/move.h"
 #include "algo/positions.h"
 #include "algo/quadratic_sort.h"
+#include "algo/sorting_network.h"
 #include "algo/type_functions.h"
 
 namespace algo {
 
 inline static constexpr int stable_sort_n_buffered_quadratic_boundary = 8;
+// Sorting networks for 32 bit numbers are relatively cheaper than for 64 bit
+// ones, so it is worth starting merges earlier.
+inline static constexpr int stable_sort_n_buffered_sorting_network_boundary_32 =
+    16;
+inline static constexpr int stable_sort_n_buffered_sorting_network_boundary = 32;
 
 template <typename I, typename N, typename B, typename R>
 // require ForwardIterator<I> && Number<N> && ForwardIterator<B>
@@ -74,25 +86,62 @@ void stable_sort_sufficient_allocation_std_merge(I f, I l) {
   stable_sort_sufficient_allocation_std_merge(f, l, std::less<>{});
 }
 
-template <typename I, typename N, typename B, typename R>
+namespace detail {
+
+template <typename I, typename R>
+constexpr int stable_sort_n_buffered_default_leaf_boundary() {
+  if constexpr (algo::sorting_network_applicable<I, R>()) {
+    return detail::sorting_network_supported_type<ValueType<I>>() &&
+                   sizeof(ValueType<I>) == 4
+               ? stable_sort_n_buffered_sorting_network_boundary_32
+               : stable_sort_n_buffered_sorting_network_boundary;
+  } else {
+    return stable_sort_n_buffered_quadratic_boundary;
+  }
+}
+
+template <int leaf_boundary, typename I, typename N, typename R>
+I stable_sort_n_buffered_leaf(I f, N n, R r) {
+  if constexpr (algo::sorting_network_applicable<I, R>() &&
+                leaf_boundary <= int(sorting_network_max_size)) {
+    return algo::stable_sort_network_n(f, n, r);
+  } else {
+    return algo::quadratic_sort_n(f, n, r);
+  }
+}
+
+}  // namespace detail
+
+template <int leaf_boundary, typename I, typename N, typename B, typename R>
 // require ForwardIterator<I> && Number<N> && ForwardIterator<B>
 //         && WeakStrictOrdering<R, ValueType<I>>
 I stable_sort_n_buffered(I f, N n, R r, B buf) {
-  if (n <= N(stable_sort_n_buffered_quadratic_boundary)) {
-    return algo::quadratic_sort_n(f, n, r);
+  if (n <= N(leaf_boundary)) {
+    return detail::stable_sort_n_buffered_leaf<leaf_boundary>(f, n, r);
   }
 
   N half = algo::half_nonnegative(n);
   auto [m, buf_l] = algo::move_n(f, half, buf);
 
-  stable_sort_n_buffered(buf, half, r, f);
-  I l = stable_sort_n_buffered(m, n - half, r, f);
+  stable_sort_n_buffered<leaf_boundary>(buf, half, r, f);
+  I l = stable_sort_n_buffered<leaf_boundary>(m, n - half, r, f);
 
   using MI = std::move_iterator<I>;
   using MB = std::move_iterator<B>;
   return algo::merge(MB(buf), MB(buf_l), MI(m), MI(l), f, r);
 }
 
+// Sorting networks do well on bigger leaves, everything else goes to
+// the insertion sort.
+template <typename I, typename N, typename B, typename R>
+// require ForwardIterator<I> && Number<N> && ForwardIterator<B>
+//         && WeakStrictOrdering<R, ValueType<I>>
+I stable_sort_n_buffered(I f, N n, R r, B buf) {
+  return algo::stable_sort_n_buffered<
+      detail::stable_sort_n_buffered_default_leaf_boundary<I, R>()>(f, n, r,
+                                                                    buf);
+}
+
 template <typename I, typename N, typename R>
 // require ForwardIterator<I> && Number<N> && ForwardIterator<B>
 //         && WeakStrictOrdering<R, ValueType<I>>
@@ -116,15 +165,81 @@ void stable_sort_sufficient_allocation(I f, I l) {
   stable_sort_sufficient_allocation(f, l, std::less<>{});
 }
 
+template <typename I, typename N, typename R, typename B>
+// require BidirectionalIterator<I> && Number<N>
+//         && WeakStrictOrdering<R, ValueType<I>> && ForwardIterator<B>
+I stable_sort_n_limited_buffer(I f, N n, R r, B buf, N buf_n) {
+  // buf_n can be anything from 0 to n / 2.
+  constexpr int leaf_boundary =
+      detail::stable_sort_n_buffered_default_leaf_boundary<I, R>();
+  if (n <= N(leaf_boundary)) {
+    return detail::stable_sort_n_buffered_leaf<leaf_boundary>(f, n, r);
+  }
+
+  N half = algo::half_nonnegative(n);
+  if (half <= buf_n) {
+    return algo::stable_sort_n_buffered<leaf_boundary>(f, n, r, buf);
+  }
+
+  I m = stable_sort_n_limited_buffer(f, half, r, buf, buf_n);
+  I l = stable_sort_n_limited_buffer(m, n - half, r, buf, buf_n);
+  detail::merge_adjacent_limited_buffer(f, m, l, half, n - half, r, buf,
+                                        buf_n);
+  return l;
+}
+
+template <typename I, typename N, typename R>
+// require BidirectionalIterator<I> && Number<N>
+//         && WeakStrictOrdering<R, ValueType<I>>
+I stable_sort_n_limited_allocation(I f, N n, R r, N max_buf_n) {
+  std::vector<ValueType<I>> buf(
+      std::min(algo::half_nonnegative(n), max_buf_n));
+  return algo::stable_sort_n_limited_buffer(f, n, r, buf.begin(),
+                                            N(buf.size()));
+}
+
+template <typename I, typename N>
+I stable_sort_n_limited_allocation(I f, N n, N max_buf_n) {
+  return algo::stable_sort_n_limited_allocation(f, n, std::less<>{},
+                                                max_buf_n);
+}
+
+template <typename I, typename R>
+void stable_sort_limited_allocation(I f, I l, R r,
+                                    DifferenceType<I> max_buf_n) {
+  algo::stable_sort_n_limited_allocation(f, std::distance(f, l), r, max_buf_n);
+}
+
+template <typename I>
+void stable_sort_limited_allocation(I f, I l, DifferenceType<I> max_buf_n) {
+  algo::stable_sort_limited_allocation(f, l, std::less<>{}, max_buf_n);
+}
+
 template <typename I, typename R>
 void stable_sort_lifting(I f, I l, R r) {
-  auto [positions, base, marker] = algo::lift_as_vector(f, l);
+  if constexpr (RandomAccessIterator<I>) {
+    // Indexes are half the size of iterators, so both sorting and
+    // rearranging move less memory.
+    algo::with_lifted_indices(f, l, [&](auto lifted) {
+      auto& [positions, marker] = lifted;
+      using N = ValueType<decltype(positions.begin())>;
+
+      stable_sort_sufficient_allocation(
+          positions.begin(), positions.end(),
+          [&](N x, N y) { return r(f[x], f[y]); });
+
+      algo::apply_rearrangment_indices(positions.begin(), positions.end(), f,
+                                       marker);
+    });
+  } else {
+    auto [positions, base, marker] = algo::lift_as_vector(f, l);
 
-  stable_sort_sufficient_allocation(
-      positions.begin(), positions.end(),
-      [&](const auto& ix, const auto& iy) { return r(*ix, *iy); });
+    stable_sort_sufficient_allocation(
+        positions.begin(), positions.end(),
+        [&](const auto& ix, const auto& iy) { return r(*ix, *iy); });
 
-  algo::apply_rearrangment(positions.begin(), positions.end(), base, marker);
+    algo::apply_rearrangment(positions.begin(), positions.end(), base, marker);
+  }
 }
 
 template <typename I>
@@ -132,6 +247,185 @@ void stable_sort_lifting(I f, I l) {
   stable_sort_sufficient_allocation(f, l, std::less<>{});
 }
 
+namespace detail {
+
+template <typename I>
+struct natural_run {
+  I f;
+  DifferenceType<I> n;
+};
+
+template <typename I, typename R>
+// require BidirectionalIterator<I> && WeakStrictOrdering<R, ValueType<I>>
+natural_run<I> find_natural_run(I f, I l, R r) {
+  // f != l
+  I prev = f;
+  I cur = std::next(f);
+  DifferenceType<I> n = 1;
+  if (cur == l) return {cur, n};
+
+  // Only strictly descending runs can be reversed without breaking stability.
+  if (r(*cur, *prev)) {
+    do {
+      prev = cur; ++cur; ++n;
+    } while (cur != l && r(*cur, *prev));
+    std::reverse(f, cur);
+    return {cur, n};
+  }
+
+  do {
+    prev = cur; ++cur; ++n;
+  } while (cur != l && !r(*cur, *prev));
+  return {cur, n};
+}
+
+template <typename N>
+// require Number<N>
+N natural_run_min_length(N n) {
+  // Same as timsort: somewhere in [32, 64], such that n / min_length is close
+  // to a power of 2.
+  N extra_bit = 0;
+  while (n >= N(64)) {
+    extra_bit |= n & N(1);
+    n >>= 1;
+  }
+  return n + extra_bit;
+}
+
+template <typename I, typename R, typename B>
+// require BidirectionalIterator<I> && WeakStrictOrdering<R, ValueType<I>>
+//         && ForwardIterator<B>
+void merge_adjacent_natural_runs(I f, I m, I l, R r, B buf) {
+  // Skip what is already in place on both sides.
+  f = algo::partition_point_biased(
+      f, m, [&](Reference<I> x) { return !r(*m, x); });
+  if (f == m) return;
+  l = algo::lower_bound_biased(m, l, *std::prev(m), r);
+
+  using MB = std::move_iterator<B>;
+
+  if (std::distance(f, m) <= std::distance(m, l)) {
+    B buf_l = algo::move(f, m, buf);
+    algo::merge_biased_second(MB(buf), MB(buf_l), std::move_iterator<I>(m),
+                              std::move_iterator<I>(l), f, r);
+    return;
+  }
+
+  // Second run is smaller: move it out and merge from the back.
+  B buf_l = algo::move(m, l, buf);
+
+  using RI = std::reverse_iterator<I>;
+  using RB = std::reverse_iterator<B>;
+  using MRI = std::move_iterator<RI>;
+  using MRB = std::move_iterator<RB>;
+
+  algo::merge_biased_second(
+      MRB(RB(buf_l)), MRB(RB(buf)), MRI(RI(m)), MRI(RI(f)), RI(l),
+      [&](const auto& x, const auto& y) { return r(y, x); });
+}
+
+inline static constexpr std::size_t natural_runs_max_stack_size = 128;
+
+template <typename I, typename R, typename B>
+// require BidirectionalIterator<I> && WeakStrictOrdering<R, ValueType<I>>
+//         && ForwardIterator<B>
+class natural_runs_stack {
+  std::array<natural_run<I>, natural_runs_max_stack_size> runs_;
+  std::size_t size_ = 0;
+  I l_;
+  R r_;
+  B buf_;
+
+  // Merges runs_[i] and runs_[i + 1].
+  void merge_at(std::size_t i) {
+    I l = i + 2 < size_ ? runs_[i + 2].f : l_;
+    merge_adjacent_natural_runs(runs_[i].f, runs_[i + 1].f, l, r_, buf_);
+    runs_[i].n += runs_[i + 1].n;
+    if (i + 2 < size_) runs_[i + 1] = runs_[i + 2];
+    --size_;
+  }
+
+  // Invariants from: "On the Worst-Case Complexity of TimSort",
+  // Auger, Jugé, Nicaud, Pivoteau.
+  void collapse() {
+    while (size_ > 1) {
+      std::size_t i = size_ - 2;
+      if ((i > 0 && runs_[i - 1].n <= runs_[i].n + runs_[i + 1].n) ||
+          (i > 1 && runs_[i - 2].n <= runs_[i - 1].n + runs_[i].n)) {
+        if (runs_[i - 1].n < runs_[i + 1].n) --i;
+      } else if (runs_[i].n > runs_[i + 1].n) {
+        break;
+      }
+      merge_at(i);
+    }
+  }
+
+ public:
+  natural_runs_stack(R r, B buf) : r_(r), buf_(buf) {}
+
+  // l is the end of the new run.
+  void push(I f, DifferenceType<I> n, I l) {
+    runs_[size_++] = {f, n};
+    l_ = l;
+    collapse();
+  }
+
+  void collapse_all() {
+    while (size_ > 1) {
+      std::size_t i = size_ - 2;
+      if (i > 0 && runs_[i - 1].n < runs_[i + 1].n) --i;
+      merge_at(i);
+    }
+  }
+};
+
+}  // namespace detail
+
+template <typename I, typename R, typename B>
+// require BidirectionalIterator<I> && WeakStrictOrdering<R, ValueType<I>>
+//         && ForwardIterator<B>
+void stable_sort_natural_runs_buffered(I f, I l, R r, B buf) {
+  // buf has to fit half of the range.
+  if (f == l) return;
+
+  const DifferenceType<I> min_length =
+      detail::natural_run_min_length(std::distance(f, l));
+
+  detail::natural_runs_stack<I, R, B> runs(r, buf);
+
+  while (f != l) {
+    auto [run_l, n] = detail::find_natural_run(f, l, r);
+
+    // Short runs are extended with insertion sort.
+    for (; n < min_length && run_l != l; ++run_l, ++n) {
+      detail::linear_insert(f, run_l, r);
+    }
+
+    runs.push(f, n, run_l);
+    f = run_l;
+  }
+
+  runs.collapse_all();
+}
+
+template <typename I, typename R>
+// require BidirectionalIterator<I> && WeakStrictOrdering<R, ValueType<I>>
+void stable_sort_natural_runs(I f, I l, R r) {
+  if (f == l) return;
+
+  // Do not allocate for the input that is already sorted.
+  if (detail::find_natural_run(f, l, r).f == l) return;
+
+  std::vector<ValueType<I>> buf(
+      algo::half_nonnegative(std::distance(f, l)));
+  algo::stable_sort_natural_runs_buffered(f, l, r, buf.begin());
+}
+
+template <typename I>
+void stable_sort_natural_runs(I f, I l) {
+  algo::stable_sort_natural_runs(f, l, std::less<>{});
+}
+
 }  // namespace algo
 
 #endif  // ALGO_STABLE_SORT_H
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_STABLE_SORT_CACHED_KEY_H
+#define ALGO_STABLE_SORT_CACHED_KEY_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "algo/apply_rearrangment.h"
+#include "algo/positions.h"
+#include "algo/stable_sort.h"
+#include "algo/type_functions.h"
+
+namespace algo {
+
+// Up to 8 bytes of s, starting from offset, packed into a number so that
+// comparing numbers is consistent with comparing strings:
+// key(x) < key(y) means x < y, provided x and y share the first offset bytes.
+// Equal keys don't mean anything.
+inline std::uint64_t string_prefix_key(std::string_view s,
+                                       std::size_t offset = 0) {
+  s.remove_prefix(std::min(offset, s.size()));
+
+  std::uint64_t res = 0;
+  std::memcpy(&res, s.data(), std::min(s.size(), sizeof(res)));
+  return __builtin_bswap64(res);
+}
+
+template <typename I, typename R, typename K>
+// require ForwardIterator<I> && WeakStrictOrdering<R, ValueType<I>>
+//         && Function<K, ValueType<I>> && TotallyOrdered<Key>
+//         where key(x) < key(y) => r(x, y)
+void stable_sort_lifting_cached_key(I f, I l, R r, K key) {
+  auto [positions, base, marker] = algo::lift_as_vector(f, l);
+
+  using position = ValueType<decltype(positions.begin())>;
+  using key_type = std::decay_t<std::invoke_result_t<K&, Reference<I>>>;
+
+  // Keys are next to positions, so most comparisons don't go to elements.
+  std::vector<std::pair<key_type, position>> keyed(positions.size());
+  std::transform(positions.begin(), positions.end(), keyed.begin(),
+                 [&](position p) { return std::pair{key(*p), p}; });
+
+  algo::stable_sort_sufficient_allocation(
+      keyed.begin(), keyed.end(), [&](const auto& x, const auto& y) {
+        if (x.first < y.first) return true;
+        if (y.first < x.first) return false;
+        return r(*x.second, *y.second);
+      });
+
+  std::transform(keyed.begin(), keyed.end(), positions.begin(),
+                 [](const auto& x) { return x.second; });
+
+  algo::apply_rearrangment(positions.begin(), positions.end(), base, marker);
+}
+
+}  // namespace algo
+
+#endif  // ALGO_STABLE_SORT_CACHED_KEY_H
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_STABLE_SORTER_H
+#define ALGO_STABLE_SORTER_H
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#include "algo/apply_rearrangment.h"
+#include "algo/half_nonnegative.h"
+#include "algo/positions.h"
+#include "algo/scratch_arena.h"
+#include "algo/stable_sort.h"
+#include "algo/type_functions.h"
+
+namespace algo {
+
+// Same as stable_sort_sufficient_allocation/stable_sort_lifting but
+// the buffers are kept between calls, so sorting a lot of small ranges
+// doesn't go to malloc every time.
+template <typename T>
+class stable_sorter {
+  scratch_arena arena_;
+
+ public:
+  stable_sorter() = default;
+  stable_sorter(stable_sorter&&) = default;
+  stable_sorter& operator=(stable_sorter&&) = default;
+
+  template <typename I, typename R>
+  // require ForwardIterator<I> && WeakStrictOrdering<R, T>
+  void sort(I f, I l, R r) {
+    static_assert(std::is_same_v<ValueType<I>, T>);
+
+    const auto n = std::distance(f, l);
+    scratch_buffer<T> buf(arena_, static_cast<std::size_t>(
+                                      algo::half_nonnegative(n)));
+    algo::stable_sort_n_buffered(f, n, r, buf.begin());
+  }
+
+  template <typename I>
+  void sort(I f, I l) {
+    sort(f, l, std::less<>{});
+  }
+
+  template <typename I, typename R>
+  // require ForwardIterator<I> && WeakStrictOrdering<R, T>
+  void sort_lifting(I f, I l, R r) {
+    static_assert(std::is_same_v<ValueType<I>, T>);
+
+    using position = lifted_iterator<I>;
+
+    // Positions followed by the buffer to sort them.
+    const auto n = std::distance(f, l);
+    scratch_buffer<position> positions(
+        arena_, static_cast<std::size_t>(n + algo::half_nonnegative(n)));
+
+    auto [positions_l, base, marker] = algo::lift(f, l, positions.begin());
+
+    algo::stable_sort_n_buffered(
+        positions.begin(), n,
+        [&](const position& x, const position& y) { return r(*x, *y); },
+        positions_l);
+
+    algo::apply_rearrangment(positions.begin(), positions_l, base, marker);
+  }
+
+  template <typename I>
+  void sort_lifting(I f, I l) {
+    sort_lifting(f, l, std::less<>{});
+  }
+
+  std::size_t capacity() const { return arena_.capacity(); }
+
+  void release() { arena_.release(); }
+};
+
+}  // namespace algo
+
+#endif  // ALGO_STABLE_SORTER_H
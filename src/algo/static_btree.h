@@ -0,0 +1,175 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_STATIC_BTREE_H
+#define ALGO_STATIC_BTREE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "algo/type_functions.h"
+#include "simd/pack.h"
+
+namespace algo {
+
+inline static constexpr std::size_t static_btree_node_bytes = 64;
+
+// Copy of a sorted range of 32/64 bit integers as a static B+-tree:
+// every node is a cache line of keys, 16 int32 or 8 int64, the leaves
+// are the original range padded with the max value.
+// https://en.algorithmica.org/hpc/data-structures/s-tree/
+//
+// The key j of an internal node is the first element in the subtree of
+// the child j + 1, so the number of keys less than the value is the child
+// to go to. It is computed for a whole node, one node per level, with
+// two 256 bit compares and popcounts: simd::pack only compares up to
+// avx2 registers, avx512 compares produce mask registers that the pack
+// does not model.
+template <typename T>
+class static_btree {
+  static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+                (sizeof(T) == 4 || sizeof(T) == 8));
+
+  using pack_t = simd::pack<T, 32 / sizeof(T)>;
+
+  static constexpr std::size_t keys = static_btree_node_bytes / sizeof(T);
+  static constexpr std::size_t children = keys + 1;
+  static constexpr std::size_t pack_size = simd::size_v<pack_t>;
+
+  std::vector<T> storage_;
+  // Aligned to the node size, layers from the root to the leaves.
+  const T* nodes_ = nullptr;
+  // Offset of each layer in nodes, the leaves are the last one.
+  std::vector<std::size_t> layers_;
+  std::size_t size_ = 0;
+
+  static std::uint32_t count_less(const T* node, const T& v) {
+    const pack_t x = simd::set_all<pack_t>(v);
+
+    std::uint32_t res = 0;
+    for (std::size_t i = 0; i != keys; i += pack_size) {
+      const pack_t y = simd::load<pack_t>(node + i);
+      res += simd::count_true(simd::greater_pairwise(x, y));
+    }
+    return res;
+  }
+
+ public:
+  static_btree() = default;
+  // The moved from tree is empty.
+  static_btree(static_btree&& x) noexcept
+      : storage_(std::move(x.storage_)),
+        nodes_(std::exchange(x.nodes_, nullptr)),
+        layers_(std::move(x.layers_)),
+        size_(std::exchange(x.size_, 0)) {}
+
+  static_btree& operator=(static_btree&& x) noexcept {
+    storage_ = std::move(x.storage_);
+    nodes_ = std::exchange(x.nodes_, nullptr);
+    layers_ = std::move(x.layers_);
+    x.layers_.clear();
+    size_ = std::exchange(x.size_, 0);
+    return *this;
+  }
+
+  // The nodes point into the storage.
+  static_btree(const static_btree&) = delete;
+  static_btree& operator=(const static_btree&) = delete;
+
+  template <typename I>
+  // require RandomAccessIterator<I> && ValueType<I> == T
+  static_btree(I f, I l) : size_(static_cast<std::size_t>(l - f)) {
+    if (!size_) return;
+
+    // Number of nodes per layer, from the leaves up.
+    std::vector<std::size_t> counts{(size_ + keys - 1) / keys};
+    while (counts.back() > 1) {
+      counts.push_back((counts.back() + children - 1) / children);
+    }
+
+    std::size_t total = 0;
+    layers_.resize(counts.size());
+    for (std::size_t h = counts.size(); h--;) {
+      layers_[counts.size() - 1 - h] = total;
+      total += counts[h];
+    }
+
+    storage_.resize(total * keys + keys);
+    const auto address = reinterpret_cast<std::uintptr_t>(storage_.data());
+    const std::size_t misalignment = address % static_btree_node_bytes;
+    const std::size_t offset =
+        misalignment ? (static_btree_node_bytes - misalignment) / sizeof(T)
+                     : 0;
+    T* nodes = storage_.data() + offset;
+
+    const T max = std::numeric_limits<T>::max();
+    const std::size_t leaves = counts.front();
+
+    T* leaf = nodes + layers_.back() * keys;
+    std::copy(f, l, leaf);
+    std::fill(leaf + size_, leaf + leaves * keys, max);
+
+    // Layer h covers children^(h - 1) leaves per child.
+    std::size_t leaves_per_child = 1;
+    for (std::size_t h = 1; h < counts.size(); ++h) {
+      T* layer = nodes + layers_[counts.size() - 1 - h] * keys;
+      for (std::size_t k = 0; k != counts[h]; ++k) {
+        for (std::size_t j = 0; j != keys; ++j) {
+          const std::size_t first_leaf =
+              (k * children + j + 1) * leaves_per_child;
+          layer[k * keys + j] = first_leaf < leaves ? leaf[first_leaf * keys]
+                                                    : max;
+        }
+      }
+      leaves_per_child *= children;
+    }
+
+    nodes_ = nodes;
+  }
+
+  std::size_t size() const { return size_; }
+
+  // Position of the lower bound in the original sorted range.
+  std::size_t lower_bound(const T& v) const {
+    if (!size_) return 0;
+
+    std::size_t k = 0;
+    for (std::size_t h = 0; h + 1 < layers_.size(); ++h) {
+      k = k * children + count_less(nodes_ + (layers_[h] + k) * keys, v);
+    }
+    // The padding is never less than v, so this is never past the end.
+    return k * keys + count_less(nodes_ + (layers_.back() + k) * keys, v);
+  }
+
+  // For integers the first element greater than v is the first one
+  // not less than v + 1.
+  std::size_t upper_bound(const T& v) const {
+    if (v == std::numeric_limits<T>::max()) return size_;
+    return lower_bound(static_cast<T>(v + 1));
+  }
+};
+
+template <typename I>
+static_btree(I, I) -> static_btree<ValueType<I>>;
+
+}  // namespace algo
+
+#endif  // ALGO_STATIC_BTREE_H
@@ -0,0 +1,196 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_STRING_SORT_H
+#define ALGO_STRING_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "algo/apply_rearrangment.h"
+#include "algo/positions.h"
+#include "algo/quadratic_sort.h"
+#include "algo/strcmp.h"
+#include "algo/type_functions.h"
+
+namespace algo {
+
+inline static constexpr std::ptrdiff_t string_sort_quadratic_boundary = 16;
+
+namespace detail {
+
+// Strings are compared as C strings, they can't have '\0' inside.
+// All string functions below are called at a depth d, such that all strings
+// in the range are known to have the same first d characters.
+
+inline unsigned char char_at(const char* s, std::size_t d) { return s[d]; }
+
+inline unsigned char char_at(const std::string& s, std::size_t d) {
+  return s[d];
+}
+
+inline unsigned char char_at(std::string_view s, std::size_t d) {
+  return d < s.size() ? s[d] : 0;
+}
+
+// Position of the first character from d where x and y differ or x ends.
+template <std::size_t width>
+std::size_t mismatch_from(const char* x, const char* y, std::size_t d) {
+  return static_cast<std::size_t>(
+      algo::strmismatch<width>(x + d, y + d).first - x);
+}
+
+template <std::size_t width>
+std::size_t mismatch_from(const std::string& x, const std::string& y,
+                          std::size_t d) {
+  return mismatch_from<width>(x.c_str(), y.c_str(), d);
+}
+
+// string_view is not null terminated, so strmismatch doesn't apply.
+template <std::size_t width>
+std::size_t mismatch_from(std::string_view x, std::string_view y,
+                          std::size_t d) {
+  const std::size_t n = std::min(x.size(), y.size());
+  return static_cast<std::size_t>(
+      std::mismatch(x.begin() + d, x.begin() + n, y.begin() + d).first -
+      x.begin());
+}
+
+inline const char* as_chars(const char* s) { return s; }
+inline const char* as_chars(const std::string& s) { return s.c_str(); }
+inline std::string_view as_chars(std::string_view s) { return s; }
+
+template <std::size_t width, typename S>
+bool string_less_from(const S& x, const S& y, std::size_t d) {
+  const std::size_t m = mismatch_from<width>(x, y, d);
+  return char_at(x, m) < char_at(y, m);
+}
+
+template <std::size_t width, typename I, typename P>
+// require RandomAccessIterator<I> && StringProjection<P, ValueType<I>>
+std::size_t common_prefix_from(I f, I l, P proj, std::size_t d) {
+  std::size_t res = std::size_t(-1);
+  for (I cur = std::next(f); cur != l; ++cur) {
+    res = std::min(res, mismatch_from<width>(proj(*f), proj(*cur), d));
+  }
+  return res;
+}
+
+template <std::size_t width, typename I, typename P>
+// require RandomAccessIterator<I> && StringProjection<P, ValueType<I>>
+void string_sort_from(I f, I l, P proj, std::size_t d) {
+  // Multikey quicksort: "Fast Algorithms for Sorting and Searching Strings",
+  // Bentley, Sedgewick.
+  while (l - f > string_sort_quadratic_boundary) {
+    auto key = [&](Reference<I> x) { return char_at(proj(x), d); };
+
+    unsigned char a = key(*f);
+    unsigned char b = key(*(f + (l - f) / 2));
+    unsigned char c = key(*std::prev(l));
+    if (b < a) std::swap(a, b);
+    const unsigned char pivot = std::max(a, std::min(b, c));
+
+    I lt = f;
+    I cur = f;
+    I gt = l;
+    while (cur != gt) {
+      const unsigned char x = key(*cur);
+      if (x < pivot) {
+        std::iter_swap(lt, cur);
+        ++lt;
+        ++cur;
+      } else if (pivot < x) {
+        --gt;
+        std::iter_swap(cur, gt);
+      } else {
+        ++cur;
+      }
+    }
+
+    // Strings that ended are equal and go first.
+    if (!pivot) {
+      f = gt;
+      continue;
+    }
+
+    const bool all_equal = lt == f && gt == l;
+
+    string_sort_from<width>(f, lt, proj, d);
+    string_sort_from<width>(gt, l, proj, d);
+    f = lt;
+    l = gt;
+
+    // Instead of going one character at a time through a common prefix
+    // (like "https://"), find all of it at once.
+    d = all_equal ? common_prefix_from<width>(f, l, proj, d + 1) : d + 1;
+  }
+
+  algo::quadratic_sort_n(f, l - f, [&](Reference<I> x, Reference<I> y) {
+    return string_less_from<width>(proj(x), proj(y), d);
+  });
+}
+
+}  // namespace detail
+
+template <std::size_t width, typename I, typename P>
+// require RandomAccessIterator<I> && StringProjection<P, ValueType<I>>
+void string_sort(I f, I l, P proj) {
+  using T = ValueType<I>;
+  if constexpr (std::is_same_v<T, const char*> || std::is_same_v<T, char*> ||
+                std::is_same_v<T, std::string_view>) {
+    detail::string_sort_from<width>(f, l, proj, 0);
+  } else {
+    // Swapping strings is expensive and every character is behind
+    // two indirections, sort pointers to the characters instead.
+    auto [positions, base, marker] = algo::lift_as_vector(f, l);
+
+    using position = ValueType<decltype(positions.begin())>;
+    using chars = std::conditional_t<
+        std::is_same_v<std::decay_t<decltype(proj(*f))>, std::string_view>,
+        std::string_view, const char*>;
+
+    std::vector<std::pair<chars, position>> lifted(positions.size());
+    std::transform(positions.begin(), positions.end(), lifted.begin(),
+                   [&](position p) {
+                     return std::pair{detail::as_chars(proj(*p)), p};
+                   });
+
+    detail::string_sort_from<width>(lifted.begin(), lifted.end(),
+                                    [](const auto& x) { return x.first; }, 0);
+
+    std::transform(lifted.begin(), lifted.end(), positions.begin(),
+                   [](const auto& x) { return x.second; });
+    algo::apply_rearrangment(positions.begin(), positions.end(), base, marker);
+  }
+}
+
+template <std::size_t width, typename I>
+// require RandomAccessIterator<I>
+void string_sort(I f, I l) {
+  algo::string_sort<width>(f, l, [](const auto& x) -> decltype(auto) {
+    return (x);
+  });
+}
+
+}  // namespace algo
+
+#endif  // ALGO_STRING_SORT_H
@@ -0,0 +1,188 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_WORK_STEALING_POOL_H
+#define ALGO_WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace algo {
+namespace detail {
+
+struct pool_task {
+  void (*run)(void*);
+  void* op;
+  std::atomic<bool> done{false};
+};
+
+template <typename Op>
+void run_pool_task(void* op) {
+  (*static_cast<Op*>(op))();
+}
+
+class pool_task_queue {
+  std::mutex mutex_;
+  std::deque<pool_task*> tasks_;
+
+ public:
+  void push(pool_task* task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(task);
+  }
+
+  // Owner side: succeeds only if nobody has stolen the task yet.
+  bool pop_if_back(pool_task* task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (tasks_.empty() || tasks_.back() != task) return false;
+    tasks_.pop_back();
+    return true;
+  }
+
+  // Thief side: takes the oldest task, which is usually the biggest one.
+  pool_task* steal() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (tasks_.empty()) return nullptr;
+    pool_task* res = tasks_.front();
+    tasks_.pop_front();
+    return res;
+  }
+};
+
+}  // namespace detail
+
+class work_stealing_pool {
+ public:
+  // thread_count includes the calling thread: it participates in the work
+  // while it waits in fork_join.
+  explicit work_stealing_pool(std::size_t thread_count) {
+    if (thread_count == 0) thread_count = 1;
+
+    queues_.reserve(thread_count);
+    for (std::size_t i = 0; i != thread_count; ++i) {
+      queues_.push_back(std::make_unique<detail::pool_task_queue>());
+    }
+
+    threads_.reserve(thread_count - 1);
+    for (std::size_t i = 1; i != thread_count; ++i) {
+      threads_.emplace_back([this, i] { worker_loop(i); });
+    }
+  }
+
+  work_stealing_pool()
+      : work_stealing_pool(std::thread::hardware_concurrency()) {}
+
+  work_stealing_pool(const work_stealing_pool&) = delete;
+  work_stealing_pool& operator=(const work_stealing_pool&) = delete;
+
+  ~work_stealing_pool() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stop_ = true;
+    }
+    wake_up_.notify_all();
+    for (auto& thread : threads_) thread.join();
+  }
+
+  std::size_t size() const { return queues_.size(); }
+
+  template <typename Op1, typename Op2>
+  // require Callable<Op1> && Callable<Op2>
+  void fork_join(Op1 op1, Op2 op2) {
+    // Operations are not allowed to throw: op2 can be in some other
+    // thread's hands by the time op1 unwinds.
+    detail::pool_task task{&detail::run_pool_task<Op2>, &op2};
+    const std::size_t idx = current_queue();
+
+    push(idx, &task);
+    op1();
+
+    if (queues_[idx]->pop_if_back(&task)) {
+      pending_.fetch_sub(1, std::memory_order_relaxed);
+      op2();
+      return;
+    }
+
+    while (!task.done.load(std::memory_order_acquire)) {
+      if (!run_one(idx)) std::this_thread::yield();
+    }
+  }
+
+ private:
+  std::size_t current_queue() const {
+    // Threads that do not belong to the pool share the first queue.
+    return tls_pool_ == this ? tls_queue_ : 0;
+  }
+
+  void push(std::size_t idx, detail::pool_task* task) {
+    queues_[idx]->push(task);
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    // Empty critical section: workers check pending_ under this mutex.
+    { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+    wake_up_.notify_one();
+  }
+
+  bool run_one(std::size_t idx) {
+    const std::size_t n = queues_.size();
+    for (std::size_t i = 1; i <= n; ++i) {
+      detail::pool_task* task = queues_[(idx + i) % n]->steal();
+      if (!task) continue;
+
+      pending_.fetch_sub(1, std::memory_order_relaxed);
+      task->run(task->op);
+      // The owner can destroy the task as soon as it sees this.
+      task->done.store(true, std::memory_order_release);
+      return true;
+    }
+    return false;
+  }
+
+  void worker_loop(std::size_t idx) {
+    tls_pool_ = this;
+    tls_queue_ = idx;
+
+    while (true) {
+      if (run_one(idx)) continue;
+
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      wake_up_.wait(lock, [&] {
+        return stop_ || pending_.load(std::memory_order_relaxed) > 0;
+      });
+      if (stop_) return;
+    }
+  }
+
+  static inline thread_local const work_stealing_pool* tls_pool_ = nullptr;
+  static inline thread_local std::size_t tls_queue_ = 0;
+
+  std::vector<std::unique_ptr<detail::pool_task_queue>> queues_;
+  std::vector<std::thread> threads_;
+
+  std::atomic<std::ptrdiff_t> pending_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_up_;
+  bool stop_ = false;
+};
+
+}  // namespace algo
+
+#endif  // ALGO_WORK_STEALING_POOL_H
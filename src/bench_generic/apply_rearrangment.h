@@ -17,6 +17,7 @@
 #ifndef BENCH_GENERIC_APPLY_REARRANGEMENT_H
 #define BENCH_GENERIC_APPLY_REARRANGEMENT_H
 
+#include <cstdint>
 #include <numeric>
 
 #include <benchmark/benchmark.h>
@@ -25,6 +26,7 @@
 #include "algo/factorial.h"
 #include "algo/nth_permutation.h"
 #include "algo/positions.h"
+#include "algo/work_stealing_pool.h"
 #include "bench_generic/declaration.h"
 #include "bench_generic/input_generators.h"
 
@@ -55,6 +57,43 @@ void apply_rearrangment_vec(benchmark::State& state) {
                                  opt_output.begin());
 }
 
+template <typename Alg, typename T>
+void apply_rearrangment_indices_vec(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  const int percentage = static_cast<int>(state.range(1));
+
+  auto data = bench::random_vector<T>(size);
+  auto shuffled = bench::shuffled_vector(size, percentage, [](size_t size) {
+    std::vector<int> idxes(size);
+    std::iota(idxes.begin(), idxes.end(), 0);
+    return idxes;
+  });
+  std::vector<std::uint32_t> positions(shuffled.begin(), shuffled.end());
+  std::vector<T> output(size);
+
+  for (auto _ : state) {
+    Alg{}(positions.begin(), positions.end(), data.begin(), output.begin());
+    benchmark::DoNotOptimize(output);
+  }
+}
+
+template <typename Alg, typename T>
+void apply_rearrangment_vec_threads(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  const size_t thread_count = static_cast<size_t>(state.range(1));
+
+  // 50% is a completly random permutation.
+  auto data = bench::random_vector<T>(size);
+  auto saved_positions = shuffled_positions(data, size, 50);
+  algo::work_stealing_pool pool(thread_count);
+
+  for (auto _ : state) {
+    auto positions = saved_positions;
+    Alg{}(positions.begin(), positions.end(), data.begin(), data.end(), pool);
+    benchmark::DoNotOptimize(data);
+  }
+}
+
 }  // namespace bench
 
 #endif  // BENCH_GENERIC_APPLY_REARRANGEMENT_H
@@ -19,6 +19,7 @@
 
 #include "algo/apply_rearrangment.h"
 #include "algo/move.h"
+#include "algo/parallel_apply_rearrangment.h"
 #include "algo/type_functions.h"
 
 #include <vector>
@@ -39,6 +40,13 @@ struct algo_apply_rearrangment {
   }
 };
 
+struct algo_apply_rearrangment_blocked {
+  template <typename II, typename I>
+  void operator()(II f, II l, I base, I, I) const {
+    algo::apply_rearrangment_blocked(f, l, base);
+  }
+};
+
 struct algo_apply_rearrangment_no_marker {
   template <typename II, typename I>
   void operator()(II f, II l, I base, I, I) const {
@@ -46,6 +54,40 @@ struct algo_apply_rearrangment_no_marker {
   }
 };
 
+struct algo_apply_rearrangment_indices_copy {
+  template <typename II, typename I>
+  void operator()(II f, II l, I base, I output) const {
+    algo::apply_rearrangment_indices_copy(f, l, base, output);
+  }
+};
+
+// The same without simd. Plain loop, like it was before gathers.
+struct scalar_apply_rearrangment_indices_copy {
+  template <typename II, typename I>
+  void operator()(II f, II l, I base, I output) const {
+    while (f != l) {
+      *output = base[*f];
+      ++output;
+      ++f;
+    }
+  }
+};
+
+struct algo_apply_rearrangment_visited_bits {
+  template <typename II, typename I>
+  void operator()(II f, II l, I base, I, I) const {
+    algo::apply_rearrangment_visited_bits(f, l, base);
+  }
+};
+
+struct algo_parallel_apply_rearrangment {
+  template <typename II, typename I>
+  void operator()(II f, II l, I base, I marker,
+                  algo::work_stealing_pool& pool) const {
+    algo::parallel_apply_rearrangment(f, l, base, marker, pool);
+  }
+};
+
 }  // namespace bench
 
 #endif  // BENCH_GENERIC_FUNCTION_OBJECTS_H
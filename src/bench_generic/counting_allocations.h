@@ -0,0 +1,62 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BENCH_GENERIC_COUNTING_ALLOCATIONS_H
+#define BENCH_GENERIC_COUNTING_ALLOCATIONS_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "bench_generic/counting_benchmark.h"
+
+// Replaces global operator new, so that counting_benchmark can report
+// allocations. Include in exactly one translation unit.
+
+namespace bench {
+namespace detail {
+
+inline void* counting_malloc(std::size_t n, std::size_t alignment) {
+  ++counting_wrapper_base::allocation;
+  n = (n + alignment - 1) / alignment * alignment;
+  if (!n) n = alignment;
+  if (void* p = std::aligned_alloc(alignment, n)) return p;
+  throw std::bad_alloc{};
+}
+
+inline const bool counting_allocations_enabled =
+    (counting_wrapper_base::count_allocations = true);
+
+}  // namespace detail
+}  // namespace bench
+
+void* operator new(std::size_t n) {
+  return bench::detail::counting_malloc(n, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t n, std::align_val_t alignment) {
+  return bench::detail::counting_malloc(n,
+                                        static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+#endif  // BENCH_GENERIC_COUNTING_ALLOCATIONS_H
@@ -32,6 +32,10 @@ struct counting_wrapper_base {
   inline static int equal;
   inline static int less;
   inline static int hash;
+  // Only counted and reported with counting_allocations.h,
+  // which sets count_allocations.
+  inline static int allocation;
+  inline static bool count_allocations;
 
   static auto tie_with_names() {
     using namespace std::literals;
@@ -45,6 +49,7 @@ struct counting_wrapper_base {
       (void)name;
       *ptr = 0;
     }
+    allocation = 0;
   }
 };
 
@@ -145,8 +150,13 @@ void counters_to_json_dict(std::ostream& out, size_t tab_length = 0) {
     out << tab << "  \"" << f->first << "\": " << *f->second << ",\n";
   }
 
-  out << tab << "  \"" << f->first << "\": " << *f->second << '\n'
-      << tab << '}';
+  out << tab << "  \"" << f->first << "\": " << *f->second;
+  if (detail::counting_wrapper_base::count_allocations) {
+    out << ",\n"
+        << tab << "  \"allocation\": "
+        << detail::counting_wrapper_base::allocation;
+  }
+  out << '\n' << tab << '}';
 }
 
 class counters_writer {
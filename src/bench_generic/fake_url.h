@@ -18,16 +18,19 @@
 #define BENCH_GENERIC_FAKE_URL_H
 
 #include <string>
+#include <string_view>
 
 namespace bench {
 
 struct fake_url {
+  static constexpr std::string_view scheme = "https://";
+
   std::string data;
 
   fake_url() = default;
 
   explicit fake_url(int seed)
-      : data("https://" + std::to_string(seed) + ".com") {}
+      : data(std::string(scheme) + std::to_string(seed) + ".com") {}
 
   template <typename H>
   friend H AbslHashValue(H h, const fake_url& x) {
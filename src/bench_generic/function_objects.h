@@ -17,13 +17,109 @@
 #ifndef BENCH_GENERIC_FUNCTION_OBJECTS_H
 #define BENCH_GENERIC_FUNCTION_OBJECTS_H
 
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
 #include "algo/binary_search_biased.h"
 #include "algo/binary_search.h"
+#include "algo/binary_search_interpolation.h"
+#include "algo/eytzinger_index.h"
+#include "algo/inplace_merge.h"
+#include "algo/learned_index.h"
+#include "algo/lower_bound_batch.h"
 #include "algo/merge_biased.h"
+#include "algo/merge_bitonic.h"
 #include "algo/merge.h"
+#include "algo/merge_k.h"
+#include "algo/parallel_merge.h"
+#include "algo/set_operations_biased.h"
+#include "algo/set_operations.h"
+#include "algo/set_operations_simd.h"
+#include "algo/static_btree.h"
 
 namespace bench {
 
+// Searches with the index that was built for the range last,
+// see lower_bound_build_index.
+struct algo_eytzinger_index {
+  template <typename T>
+  static algo::eytzinger_index<T>& index() {
+    static algo::eytzinger_index<T> res;
+    return res;
+  }
+
+  template <typename I>
+  void build(I f, I l) const {
+    using T = algo::ValueType<I>;
+    index<T>() = algo::eytzinger_index<T>(f, l);
+  }
+
+  template <typename I, typename V, typename Cmp>
+  I operator()(I f, I, const V& v, Cmp cmp) const {
+    using T = algo::ValueType<I>;
+    return f +
+           static_cast<algo::DifferenceType<I>>(index<T>().lower_bound(v, cmp));
+  }
+};
+
+// Same as algo_eytzinger_index, only for std::less on integers.
+struct algo_static_btree {
+  template <typename T>
+  static algo::static_btree<T>& index() {
+    static algo::static_btree<T> res;
+    return res;
+  }
+
+  template <typename I>
+  void build(I f, I l) const {
+    using T = algo::ValueType<I>;
+    index<T>() = algo::static_btree<T>(f, l);
+  }
+
+  template <typename I, typename V, typename Cmp>
+  I operator()(I f, I, const V& v, Cmp) const {
+    using T = algo::ValueType<I>;
+    return f + static_cast<algo::DifferenceType<I>>(index<T>().lower_bound(v));
+  }
+};
+
+// Same as algo_eytzinger_index.
+struct algo_learned_index {
+  template <typename I>
+  static algo::learned_index<I>& index() {
+    static algo::learned_index<I> res;
+    return res;
+  }
+
+  template <typename I>
+  void build(I f, I l) const {
+    index<I>() = algo::learned_index<I>(f, l);
+  }
+
+  template <typename I, typename V, typename Cmp>
+  I operator()(I, I, const V& v, Cmp) const {
+    return index<I>().lower_bound(v);
+  }
+};
+
+// Inplace merges are called with the buffer size,
+// the ones that don't take it ignore it.
+struct algo_inplace_merge {
+  template <typename I, typename R, typename N>
+  void operator()(I f, I m, I l, R r, N) const {
+    algo::inplace_merge(f, m, l, r);
+  }
+};
+
+struct algo_inplace_merge_limited_allocation {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::inplace_merge_limited_allocation(std::forward<Args>(args)...);
+  }
+};
+
 struct algo_lower_bound {
   template <typename... Args>
   auto operator()(Args&&... args) const {
@@ -31,6 +127,20 @@ struct algo_lower_bound {
   }
 };
 
+struct algo_lower_bound_batch {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::lower_bound_batch(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_lower_bound_batch_sorted {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::lower_bound_batch_sorted(std::forward<Args>(args)...);
+  }
+};
+
 struct algo_lower_bound_biased {
   template <typename... Args>
   auto operator()(Args&&... args) const {
@@ -45,6 +155,14 @@ struct algo_lower_bound_biased_expensive_cmp {
   }
 };
 
+// Only for std::less.
+struct algo_lower_bound_interpolation {
+  template <typename I, typename V, typename Cmp>
+  I operator()(I f, I l, const V& v, Cmp) const {
+    return algo::lower_bound_interpolation(f, l, v);
+  }
+};
+
 struct algo_lower_bound_linear {
   template <typename... Args>
   auto operator()(Args&&... args) const {
@@ -59,6 +177,20 @@ struct algo_merge {
   }
 };
 
+struct algo_merge_branchless {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::merge_branchless(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_merge_bitonic {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::merge_bitonic(std::forward<Args>(args)...);
+  }
+};
+
 struct algo_merge_expensive_cmp {
   template <typename... Args>
   auto operator()(Args&&... args) const {
@@ -66,6 +198,13 @@ struct algo_merge_expensive_cmp {
   }
 };
 
+struct algo_merge_adaptive {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::merge_adaptive(std::forward<Args>(args)...);
+  }
+};
+
 struct algo_merge_biased_first {
   template <typename... Args>
   auto operator()(Args&&... args) const {
@@ -80,6 +219,207 @@ struct algo_merge_biased_second {
   }
 };
 
+struct algo_merge_k {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::merge_k(std::forward<Args>(args)...);
+  }
+};
+
+// What merge_k replaces: log k passes of two way merges.
+// Rounds ping-pong between two output sized buffers, set up by
+// prepare before the measured loop. The first round reads the input runs,
+// the last one writes to the output.
+struct algo_merge_pairwise {
+  template <typename T>
+  struct run {
+    const T* f;
+    const T* l;
+    size_t offset;  // In the output.
+    bool in_buffer;
+  };
+
+  template <typename T>
+  struct buffers {
+    std::vector<T> data[2];
+    std::vector<run<T>> runs;
+    std::vector<run<T>> merged;
+  };
+
+  template <typename T>
+  static buffers<T>& get_buffers() {
+    static buffers<T> res;
+    return res;
+  }
+
+  template <typename T>
+  void prepare(size_t size, size_t k) const {
+    auto& b = get_buffers<T>();
+    b.data[0].resize(size);
+    b.data[1].resize(size);
+    b.runs.reserve(k);
+    b.merged.reserve(k);
+  }
+
+  template <typename IR, typename O, typename Cmp>
+  O operator()(IR f, IR l, O o, Cmp cmp) const {
+    using T = typename std::iterator_traits<IR>::value_type::value_type;
+
+    auto& b = get_buffers<T>();
+    b.runs.clear();
+    size_t offset = 0;
+    for (; f != l; ++f) {
+      b.runs.push_back({f->data(), f->data() + f->size(), offset, false});
+      offset += f->size();
+    }
+
+    if (b.runs.empty()) return o;
+    if (b.runs.size() == 1) return std::copy(b.runs[0].f, b.runs[0].l, o);
+
+    size_t d = 0;
+    while (b.runs.size() > 2) {
+      T* dst = b.data[d].data();
+      b.merged.clear();
+      for (size_t i = 0; i + 1 < b.runs.size(); i += 2) {
+        const run<T>& x = b.runs[i];
+        const run<T>& y = b.runs[i + 1];
+        T* out = dst + x.offset;
+        b.merged.push_back({out, algo::merge(x.f, x.l, y.f, y.l, out, cmp),
+                            x.offset, true});
+      }
+      if (b.runs.size() % 2) {
+        // An input run is read in place. A buffered one is in the next
+        // round's destination and has to move out of the way.
+        run<T> r = b.runs.back();
+        if (r.in_buffer) {
+          T* out = dst + r.offset;
+          r.l = std::copy(r.f, r.l, out);
+          r.f = out;
+        }
+        b.merged.push_back(r);
+      }
+      std::swap(b.runs, b.merged);
+      d ^= 1;
+    }
+
+    const run<T>& x = b.runs[0];
+    const run<T>& y = b.runs[1];
+    return algo::merge(x.f, x.l, y.f, y.l, o, cmp);
+  }
+};
+
+struct algo_parallel_merge {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::parallel_merge(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_parallel_merge_biased_first {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::parallel_merge_biased_first(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_parallel_merge_biased_second {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::parallel_merge_biased_second(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_set_difference {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::set_difference(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_set_difference_biased {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::set_difference_biased(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_set_difference_simd {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::set_difference_simd(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_set_intersection {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::set_intersection(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_set_intersection_biased {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::set_intersection_biased(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_set_intersection_simd {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::set_intersection_simd(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_set_symmetric_difference {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::set_symmetric_difference(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_set_symmetric_difference_biased {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::set_symmetric_difference_biased(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_set_symmetric_difference_simd {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::set_symmetric_difference_simd(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_set_union {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::set_union(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_set_union_biased {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::set_union_biased(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_set_union_simd {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::set_union_simd(std::forward<Args>(args)...);
+  }
+};
+
+struct std_inplace_merge {
+  template <typename I, typename R, typename N>
+  void operator()(I f, I m, I l, R r, N) const {
+    std::inplace_merge(f, m, l, r);
+  }
+};
+
 struct std_lower_bound {
   template <typename... Args>
   auto operator()(Args&&... args) const {
@@ -87,6 +427,24 @@ struct std_lower_bound {
   }
 };
 
+// One std::lower_bound per query, to compare the batches with.
+struct std_lower_bound_batch {
+  template <typename I, typename IQ, typename O, typename Cmp>
+  O operator()(I f, I l, IQ qf, IQ ql, O o, Cmp cmp) const {
+    return std::transform(qf, ql, o, [&](const auto& v) {
+      return std::lower_bound(f, l, v, cmp);
+    });
+  }
+};
+
+// What algo::lower_bound_linear is for types without simd.
+struct std_lower_bound_linear {
+  template <typename I, typename V, typename Cmp>
+  I operator()(I f, I l, const V& v, Cmp cmp) const {
+    return std::find_if(f, l, [&](const auto& x) { return !cmp(x, v); });
+  }
+};
+
 struct std_merge {
   template <typename... Args>
   auto operator()(Args&&... args) const {
@@ -94,6 +452,34 @@ struct std_merge {
   }
 };
 
+struct std_set_difference {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return std::set_difference(std::forward<Args>(args)...);
+  }
+};
+
+struct std_set_intersection {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return std::set_intersection(std::forward<Args>(args)...);
+  }
+};
+
+struct std_set_symmetric_difference {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return std::set_symmetric_difference(std::forward<Args>(args)...);
+  }
+};
+
+struct std_set_union {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return std::set_union(std::forward<Args>(args)...);
+  }
+};
+
 }  // namespace bench
 
 #endif  // BENCH_GENERIC_FUNCTION_OBJECTS_H
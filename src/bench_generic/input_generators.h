@@ -21,8 +21,11 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <random>
 #include <set>
+#include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -46,6 +49,8 @@ using std_int64_t = std::int64_t;
 
 using fake_url_pair = std::pair<fake_url, fake_url>;
 
+using url_string = std::string;
+
 using uint_std_pair32 = std::pair<std::uint32_t, std::uint32_t>;
 using uint_std_pair64 = std::pair<std::uint64_t, std::uint64_t>;
 
@@ -108,6 +113,26 @@ struct generate_t<fake_url> {
   }
 };
 
+// A few hosts and paths, so that a lot of urls share long prefixes.
+template <>
+struct generate_t<url_string> {
+  template <typename Src>
+  url_string operator()(Src& src) const {
+    static constexpr std::array<std::string_view, 4> hosts = {
+        "github.com/", "en.wikipedia.org/wiki/", "www.google.com/search?q=",
+        "stackoverflow.com/questions/"};
+    static constexpr std::array<std::string_view, 4> paths = {
+        "", "users/", "articles/2019/", "static/images/thumbnails/"};
+
+    const int seed = src();
+    url_string res(fake_url::scheme);
+    res += hosts[static_cast<std::size_t>(seed) % hosts.size()];
+    res += paths[static_cast<std::size_t>(seed) / hosts.size() % paths.size()];
+    res += std::to_string(seed);
+    return res;
+  }
+};
+
 template <>
 struct generate_t<noinline_int> {
   template <typename Src>
@@ -157,6 +182,17 @@ auto uniform_src(size_t size) {
   };
 }
 
+// Most of the values are small: exponential distribution with the mean
+// of size.
+auto exponential_src(size_t size) {
+  return [ed = std::exponential_distribution<>{
+              1.0 / static_cast<double>(size)}]() mutable {
+    return 1 + static_cast<int>(std::min(
+                   ed(static_generator()),
+                   static_cast<double>(std::numeric_limits<int>::max() - 1)));
+  };
+}
+
 }  // namespace detail
 
 template <typename T>
@@ -181,6 +217,17 @@ std::vector<T> sorted_vector(size_t size) {
   return gen(size);
 }
 
+template <typename T>
+std::vector<T> skewed_sorted_vector(size_t size) {
+  using namespace detail;
+
+  static auto gen = algo::memoized_function<size_t>([](size_t size) {
+    return generate_sorted_vector<T>(size, exponential_src(size));
+  });
+
+  return gen(size);
+}
+
 template <typename T>
 std::pair<std::vector<T>, std::vector<T>> two_random_vectors(size_t x_size,
                                                              size_t y_size) {
@@ -211,6 +258,27 @@ std::pair<std::vector<T>, std::vector<T>> two_sorted_vectors(size_t x_size,
   return gen({x_size, y_size});
 }
 
+// Each vector has no duplicates, keys come from twice as many values
+// as there are elements in total, so a lot of them are in both vectors.
+template <typename T>
+std::pair<std::vector<T>, std::vector<T>> two_unique_sorted_vectors(
+    size_t x_size, size_t y_size) {
+  using namespace detail;
+
+  static auto gen = algo::memoized_function<std::pair<size_t, size_t>>(
+      [](std::pair<size_t, size_t> sizes) {
+        const int max = static_cast<int>(sizes.first + sizes.second) * 2;
+        auto src = [ud = std::uniform_int_distribution<>{1, max}]() mutable {
+          return ud(static_generator());
+        };
+        return std::make_pair(
+            generate_unique_sorted_vector<T>(sizes.first, src),
+            generate_unique_sorted_vector<T>(sizes.second, src));
+      });
+
+  return gen({x_size, y_size});
+}
+
 template <typename T>
 std::vector<T> nth_vector_permutation(size_t size, int percentage) {
   auto sorted_vec = sorted_vector<T>(size);
@@ -17,6 +17,13 @@
 #ifndef BENCH_GENERIC_LOWER_BOUND_H
 #define BENCH_GENERIC_LOWER_BOUND_H
 
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
 #include "bench_generic/declaration.h"
@@ -24,25 +31,60 @@
 
 namespace bench {
 
+inline constexpr size_t lower_bound_random_queries_count = 1 << 16;
+
+template <typename Alg, typename I>
+using lower_bound_build_t =
+    decltype(std::declval<const Alg&>().build(std::declval<I>(),
+                                              std::declval<I>()));
+
+template <typename Alg, typename I, typename = void>
+struct lower_bound_has_index : std::false_type {};
+
+template <typename Alg, typename I>
+struct lower_bound_has_index<Alg, I, std::void_t<lower_bound_build_t<Alg, I>>>
+    : std::true_type {};
+
+// Searches with an index (algo_eytzinger_index, ...) need it built
+// for the range, this is done before the measured loop.
+template <typename Alg, typename I>
+void lower_bound_build_index(I f, I l) {
+  if constexpr (lower_bound_has_index<Alg, I>::value) Alg{}.build(f, l);
+}
+
 template <typename Alg, typename R, typename V, typename Cmp>
 BENCH_DECL_ATTRIBUTES void lower_bound_common(benchmark::State& state,
                                               const R& r, const V& v, Cmp cmp) {
+  lower_bound_build_index<Alg>(r.begin(), r.end());
   for (auto _ : state) {
     benchmark::DoNotOptimize(Alg{}(r.begin(), r.end(), v, cmp));
   }
 }
 
 template <typename Alg, typename T>
-void lower_bound_vec(benchmark::State& state) {
+void lower_bound_vec_common(benchmark::State& state,
+                            const std::vector<T>& input) {
   const size_t size = static_cast<size_t>(state.range(0));
   const size_t percentage = static_cast<size_t>(state.range(1));
 
-  const auto input = sorted_vector<T>(size);
   const T value = input[(size - 1) * percentage / 100];
 
   lower_bound_common<Alg>(state, input, value, std::less<>{});
 }
 
+template <typename Alg, typename T>
+void lower_bound_vec(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  lower_bound_vec_common<Alg>(state, sorted_vector<T>(size));
+}
+
+// Most of the keys are small, see skewed_sorted_vector.
+template <typename Alg, typename T>
+void lower_bound_vec_skewed(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  lower_bound_vec_common<Alg>(state, skewed_sorted_vector<T>(size));
+}
+
 template <typename Alg, typename T>
 void lower_bound_vec_first_5_percent(benchmark::State& state) {
   const size_t size = static_cast<size_t>(state.range(0));
@@ -54,6 +96,91 @@ void lower_bound_vec_first_5_percent(benchmark::State& state) {
   lower_bound_common<Alg>(state, input, value, std::less<>{});
 }
 
+// Random elements of the input, so that for big sizes every search
+// goes to memory.
+template <typename Alg, typename T>
+void lower_bound_vec_random_queries_common(benchmark::State& state,
+                                           const std::vector<T>& input) {
+  const size_t size = static_cast<size_t>(state.range(0));
+
+  std::vector<T> queries(lower_bound_random_queries_count);
+  std::mt19937 g;
+  std::uniform_int_distribution<size_t> dis(0, size - 1);
+  std::generate(queries.begin(), queries.end(),
+                [&] { return input[dis(g)]; });
+
+  lower_bound_build_index<Alg>(input.begin(), input.end());
+
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        Alg{}(input.begin(), input.end(), queries[i], std::less<>{}));
+    i = (i + 1) % queries.size();
+  }
+}
+
+template <typename Alg, typename T>
+void lower_bound_vec_random_queries(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  lower_bound_vec_random_queries_common<Alg>(state, sorted_vector<T>(size));
+}
+
+template <typename Alg, typename T>
+void lower_bound_vec_random_queries_skewed(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  lower_bound_vec_random_queries_common<Alg>(state,
+                                             skewed_sorted_vector<T>(size));
+}
+
+// Batches are random elements of the input, the batch size is
+// the second argument of the benchmark.
+template <typename T>
+std::vector<T> lower_bound_batch_queries(const std::vector<T>& input,
+                                         size_t batch) {
+  std::vector<T> queries(batch);
+  std::mt19937 g;
+  std::uniform_int_distribution<size_t> dis(0, input.size() - 1);
+  std::generate(queries.begin(), queries.end(),
+                [&] { return input[dis(g)]; });
+  return queries;
+}
+
+template <typename Alg, typename T>
+BENCH_DECL_ATTRIBUTES void lower_bound_batch_common(
+    benchmark::State& state, const std::vector<T>& input,
+    const std::vector<T>& queries) {
+  std::vector<typename std::vector<T>::const_iterator> res(queries.size());
+  for (auto _ : state) {
+    Alg{}(input.begin(), input.end(), queries.begin(), queries.end(),
+          res.begin(), std::less<>{});
+    benchmark::DoNotOptimize(res.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+template <typename Alg, typename T>
+void lower_bound_batch_vec(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  const size_t batch = static_cast<size_t>(state.range(1));
+
+  const auto input = sorted_vector<T>(size);
+  const auto queries = lower_bound_batch_queries(input, batch);
+
+  lower_bound_batch_common<Alg>(state, input, queries);
+}
+
+template <typename Alg, typename T>
+void lower_bound_batch_vec_sorted_queries(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  const size_t batch = static_cast<size_t>(state.range(1));
+
+  const auto input = sorted_vector<T>(size);
+  auto queries = lower_bound_batch_queries(input, batch);
+  std::sort(queries.begin(), queries.end());
+
+  lower_bound_batch_common<Alg>(state, input, queries);
+}
+
 }  // namespace bench
 
 #endif  // BENCH_GENERIC_LOWER_BOUND_H
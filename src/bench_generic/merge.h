@@ -17,11 +17,16 @@
 #ifndef BENCH_GENERIC_MERGE_H
 #define BENCH_GENERIC_MERGE_H
 
+#include <algorithm>
+#include <cstddef>
 #include <functional>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <benchmark/benchmark.h>
 
+#include "algo/work_stealing_pool.h"
 #include "bench_generic/declaration.h"
 #include "bench_generic/input_generators.h"
 
@@ -36,6 +41,57 @@ BENCH_DECL_ATTRIBUTES void merge_common(benchmark::State& state, RX&& rx,
   }
 }
 
+template <typename Alg, typename RX, typename RY, typename RO, typename Cmp>
+BENCH_DECL_ATTRIBUTES void merge_threads_common(
+    benchmark::State& state, RX&& rx, RY&& ry, RO&& ro, Cmp cmp,
+    algo::work_stealing_pool& pool) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Alg{}(rx.begin(), rx.end(), ry.begin(), ry.end(),
+                                   ro.begin(), cmp, pool));
+  }
+}
+
+template <typename Alg, typename T>
+using merge_k_prepare_t = decltype(
+    std::declval<const Alg&>().template prepare<T>(size_t{}, size_t{}));
+
+template <typename Alg, typename T, typename = void>
+struct merge_k_has_buffers : std::false_type {};
+
+template <typename Alg, typename T>
+struct merge_k_has_buffers<Alg, T, std::void_t<merge_k_prepare_t<Alg, T>>>
+    : std::true_type {};
+
+// Merges with buffers (algo_merge_pairwise) allocate them
+// before the measured loop.
+template <typename Alg, typename T>
+void merge_k_prepare(size_t size, size_t k) {
+  if constexpr (merge_k_has_buffers<Alg, T>::value) {
+    Alg{}.template prepare<T>(size, k);
+  }
+}
+
+template <typename Alg, typename RR, typename RO, typename Cmp>
+BENCH_DECL_ATTRIBUTES void merge_k_common(benchmark::State& state, RR&& runs,
+                                          RO&& ro, Cmp cmp) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        Alg{}(runs.begin(), runs.end(), ro.begin(), cmp));
+  }
+}
+
+template <typename Alg, typename R, typename Cmp, typename N>
+BENCH_DECL_ATTRIBUTES void inplace_merge_common(benchmark::State& state,
+                                                const R& r, size_t m, Cmp cmp,
+                                                N buffer_size) {
+  for (auto _ : state) {
+    R copy = r;
+    Alg{}(copy.begin(), copy.begin() + static_cast<std::ptrdiff_t>(m),
+          copy.end(), cmp, buffer_size);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
 template <typename Alg, typename T>
 void merge_vec(benchmark::State& state) {
   const size_t size = static_cast<size_t>(state.range(0));
@@ -64,6 +120,61 @@ void merge_with_small(benchmark::State& state) {
   merge_common<Alg>(state, x_vec, y_vec, o_vec, std::less<>{});
 }
 
+// The first run has skew percent of all elements (equal share for 0),
+// the rest is split evenly.
+template <typename Alg, typename T>
+void merge_k_vec(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  const size_t k = static_cast<size_t>(state.range(1));
+  const size_t skew = static_cast<size_t>(state.range(2));
+
+  const size_t first_size = skew ? size * skew / 100 : size / k;
+
+  auto vec = random_vector<T>(size);
+  std::vector<std::vector<T>> runs;
+  auto f = vec.begin();
+  for (size_t i = 0; i != k; ++i) {
+    const size_t rest = static_cast<size_t>(vec.end() - f);
+    const size_t run_size = i ? rest / (k - i) : first_size;
+    runs.emplace_back(f, f + static_cast<std::ptrdiff_t>(run_size));
+    std::sort(runs.back().begin(), runs.back().end());
+    f += static_cast<std::ptrdiff_t>(run_size);
+  }
+  std::vector<T> o_vec(size);
+
+  merge_k_prepare<Alg, T>(size, k);
+  merge_k_common<Alg>(state, runs, o_vec, std::less<>{});
+}
+
+template <typename Alg, typename T>
+void merge_vec_threads(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  const size_t thread_count = static_cast<size_t>(state.range(1));
+
+  auto [x_vec, y_vec] = two_sorted_vectors<T>(size / 2, size - size / 2);
+  std::vector<T> o_vec(size);
+  algo::work_stealing_pool pool(thread_count);
+
+  merge_threads_common<Alg>(state, x_vec, y_vec, o_vec, std::less<>{}, pool);
+}
+
+// Two sorted halves of the same size, the buffer is percentage of a half.
+template <typename Alg, typename T>
+void inplace_merge_vec_buffer(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  const int percentage = static_cast<int>(state.range(1));
+
+  auto [x_vec, y_vec] = two_sorted_vectors<T>(size / 2, size - size / 2);
+  std::vector<T> vec(x_vec);
+  vec.insert(vec.end(), y_vec.begin(), y_vec.end());
+
+  using N = typename std::vector<T>::difference_type;
+  const N buffer_size = static_cast<N>(size / 2 * percentage / 100);
+
+  inplace_merge_common<Alg>(state, vec, x_vec.size(), std::less<>{},
+                            buffer_size);
+}
+
 }  // namespace bench
 
 #endif  // BENCH_GENERIC_MERGE_H
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BENCH_GENERIC_SET_OPERATIONS_H
+#define BENCH_GENERIC_SET_OPERATIONS_H
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "bench_generic/input_generators.h"
+#include "bench_generic/merge.h"
+
+namespace bench {
+
+// Same as merge_vec/merge_with_small but the vectors have no duplicates
+// and share a lot of elements.
+
+template <typename Alg, typename T>
+void set_operation_vec(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  const size_t percentage = static_cast<size_t>(state.range(1));
+
+  const size_t y_size = size * percentage / 100;
+  const size_t x_size = size - y_size;
+
+  auto [x_vec, y_vec] = two_unique_sorted_vectors<T>(x_size, y_size);
+  std::vector<T> o_vec(x_size + y_size);
+
+  merge_common<Alg>(state, x_vec, y_vec, o_vec, std::less<>{});
+}
+
+template <size_t small_size, typename Alg, typename T>
+void set_operation_with_small(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  const size_t percentage = static_cast<size_t>(state.range(1));
+
+  const size_t y_size = small_size * percentage / 100;
+  const size_t x_size = size - y_size;
+
+  auto [x_vec, y_vec] = two_unique_sorted_vectors<T>(x_size, y_size);
+  std::vector<T> o_vec(x_size + y_size);
+
+  merge_common<Alg>(state, x_vec, y_vec, o_vec, std::less<>{});
+}
+
+}  // namespace bench
+
+#endif  // BENCH_GENERIC_SET_OPERATIONS_H
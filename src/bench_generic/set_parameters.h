@@ -17,6 +17,9 @@
 #ifndef BENCH_SET_PARAMETERS_H
 #define BENCH_SET_PARAMETERS_H
 
+#include <algorithm>
+#include <thread>
+
 #include <benchmark/benchmark.h>
 #include "bench_generic/counting_benchmark.h"
 
@@ -62,6 +65,40 @@ inline void set_every_int_size(benchmark::internal::Benchmark* b) {
   b->Args({static_cast<int>(total_size), 64});
 }
 
+template <size_t total_size>
+inline void set_buffer_percentages(benchmark::internal::Benchmark* b) {
+  for (int percentage : {0, 1, 5, 10, 25, 50, 100}) {
+    b->Args({static_cast<int>(total_size), percentage});
+  }
+}
+
+template <size_t total_size>
+inline void set_thread_counts(benchmark::internal::Benchmark* b) {
+  const int max_threads =
+      std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  for (int threads = 1; threads < max_threads; threads *= 2) {
+    b->Args({static_cast<int>(total_size), threads});
+  }
+  b->Args({static_cast<int>(total_size), max_threads});
+  b->UseRealTime();
+}
+
+template <size_t total_size>
+inline void set_batch_sizes(benchmark::internal::Benchmark* b) {
+  for (int batch : {1 << 10, 1 << 12, 1 << 14, 1 << 16}) {
+    b->Args({static_cast<int>(total_size), batch});
+  }
+}
+
+template <size_t total_size>
+inline void set_k_and_skew(benchmark::internal::Benchmark* b) {
+  for (int k : {2, 8, 64, 256, 1024}) {
+    for (int skew : {0, 50, 90, 99}) {
+      b->Args({static_cast<int>(total_size), k, skew});
+    }
+  }
+}
+
 }  // namespace bench
 
 #endif  // BENCH_SET_PARAMETERS_H
@@ -23,6 +23,7 @@
 #include <benchmark/benchmark.h>
 #include <boost/multiprecision/cpp_int.hpp>
 
+#include "algo/work_stealing_pool.h"
 #include "bench_generic/declaration.h"
 #include "bench_generic/input_generators.h"
 
@@ -38,6 +39,28 @@ BENCH_DECL_ATTRIBUTES void sort_common(benchmark::State& state, const R& r,
   }
 }
 
+template <typename Alg, typename R, typename Cmp>
+BENCH_DECL_ATTRIBUTES void sort_threads_common(benchmark::State& state,
+                                               const R& r, Cmp cmp,
+                                               algo::work_stealing_pool& pool) {
+  for (auto _ : state) {
+    R copy = r;
+    Alg{}(copy.begin(), copy.end(), cmp, pool);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+template <typename Alg, typename R, typename Cmp, typename N>
+BENCH_DECL_ATTRIBUTES void sort_buffer_common(benchmark::State& state,
+                                              const R& r, Cmp cmp,
+                                              N buffer_size) {
+  for (auto _ : state) {
+    R copy = r;
+    Alg{}(copy.begin(), copy.end(), cmp, buffer_size);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
 template <typename Alg, typename T>
 void sort_vec(benchmark::State& state) {
   const size_t size = static_cast<size_t>(state.range(0));
@@ -59,6 +82,30 @@ void sort_vec_size(benchmark::State& state) {
   sort_common<Alg>(state, vec, std::less<>{});
 }
 
+template <typename Alg, typename T>
+void sort_vec_threads(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  const size_t thread_count = static_cast<size_t>(state.range(1));
+
+  auto vec = random_vector<T>(size);
+  algo::work_stealing_pool pool(thread_count);
+
+  sort_threads_common<Alg>(state, vec, std::less<>{}, pool);
+}
+
+template <typename Alg, typename T>
+void sort_vec_buffer(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  const int percentage = static_cast<int>(state.range(1));
+
+  auto vec = random_vector<T>(size);
+  using N = typename std::vector<T>::difference_type;
+  // Percentage of the half size buffer that the merge sort needs.
+  const N buffer_size = static_cast<N>(size / 2 * percentage / 100);
+
+  sort_buffer_common<Alg>(state, vec, std::less<>{}, buffer_size);
+}
+
 }  // namespace bench
 
 #endif  // BENCH_GENERIC_SORT_H
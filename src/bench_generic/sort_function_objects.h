@@ -17,7 +17,20 @@
 #ifndef BENCH_GENERIC_SORT_FUNCTION_OBJECTS_H
 #define BENCH_GENERIC_SORT_FUNCTION_OBJECTS_H
 
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "algo/parallel_stable_sort.h"
+#include "algo/radix_stable_sort.h"
 #include "algo/stable_sort.h"
+#include "algo/stable_sort_cached_key.h"
+#include "algo/stable_sorter.h"
+#include "algo/string_sort.h"
+#include "algo/type_functions.h"
+#include "bench_generic/fake_url.h"
 
 namespace bench {
 
@@ -36,6 +49,13 @@ struct algo_stable_sort_sufficient_allocation_std_merge {
   }
 };
 
+struct algo_stable_sort_limited_allocation {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::stable_sort_limited_allocation(std::forward<Args>(args)...);
+  }
+};
+
 struct algo_stable_sort_lifting {
   template <typename... Args>
   auto operator()(Args&&... args) const {
@@ -43,6 +63,79 @@ struct algo_stable_sort_lifting {
   }
 };
 
+// The sorter is static, so the memory is reused between calls.
+struct algo_stable_sorter {
+  template <typename I, typename Cmp>
+  void operator()(I f, I l, Cmp cmp) const {
+    static algo::stable_sorter<algo::ValueType<I>> sorter;
+    sorter.sort(f, l, cmp);
+  }
+};
+
+struct algo_stable_sorter_lifting {
+  template <typename I, typename Cmp>
+  void operator()(I f, I l, Cmp cmp) const {
+    static algo::stable_sorter<algo::ValueType<I>> sorter;
+    sorter.sort_lifting(f, l, cmp);
+  }
+};
+
+// All urls have the same scheme, the key is what comes after.
+inline std::uint64_t cached_key(const fake_url& x) {
+  return algo::string_prefix_key(x.data, fake_url::scheme.size());
+}
+
+template <typename T, typename U>
+auto cached_key(const std::pair<T, U>& x) {
+  return cached_key(x.first);
+}
+
+struct algo_stable_sort_lifting_cached_key {
+  template <typename I, typename Cmp>
+  void operator()(I f, I l, Cmp cmp) const {
+    algo::stable_sort_lifting_cached_key(
+        f, l, cmp, [](const auto& x) { return cached_key(x); });
+  }
+};
+
+// Sorts by the url string.
+inline const std::string& string_key(const fake_url& x) { return x.data; }
+inline const std::string& string_key(const std::string& x) { return x; }
+
+struct algo_string_sort {
+  template <typename I, typename Cmp>
+  void operator()(I f, I l, Cmp) const {
+    // String sort only knows the natural order.
+    static_assert(std::is_same_v<Cmp, std::less<>>);
+    algo::string_sort<16>(f, l, [](const auto& x) -> const std::string& {
+      return string_key(x);
+    });
+  }
+};
+
+struct algo_stable_sort_natural_runs {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::stable_sort_natural_runs(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_radix_stable_sort {
+  template <typename I, typename Cmp>
+  void operator()(I f, I l, Cmp) const {
+    // Radix sort only knows the natural order.
+    static_assert(std::is_same_v<Cmp, std::less<>>);
+    algo::radix_stable_sort(f, l);
+  }
+};
+
+struct algo_parallel_stable_sort {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::parallel_stable_sort(std::forward<Args>(args)...);
+  }
+};
+
 struct baseline_sort {
   template <typename... Args>
   void operator()(Args&&...) const {}
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench_generic/counting_allocations.h"
+#include "bench_generic/counting_benchmark.h"
+#include "bench_generic/function_objects.h"
+#include "bench_generic/input_generators.h"
+#include "bench_generic/set_counting_parameters.h"
+
+namespace {
+
+// Two sorted halves, the buffer is percentage of a half.
+template <typename Alg, typename T>
+void inplace_merge_buffer_counting_bench(const std::vector<int>& args) {
+  const size_t size = static_cast<size_t>(args[0]);
+  const int percentage = args[1];
+
+  auto [x_vec, y_vec] = bench::two_sorted_vectors<T>(size / 2, size - size / 2);
+  std::vector<T> raw_vec(x_vec);
+  raw_vec.insert(raw_vec.end(), y_vec.begin(), y_vec.end());
+  std::vector<bench::counting_wrapper<T>> vec(raw_vec.begin(), raw_vec.end());
+
+  using N = typename std::vector<T>::difference_type;
+  const N buffer_size = static_cast<N>(size / 2 * percentage / 100);
+  const auto m = vec.begin() + static_cast<N>(x_vec.size());
+
+  // Only count the merge itself.
+  bench::clear_counters();
+  Alg{}(vec.begin(), m, vec.end(), std::less<>{}, buffer_size);
+}
+
+}  // namespace
+
+int main() {
+  bench::counting_benchmark b(std::cout);
+  bench::set_every_5th_percent<1000>(&b);
+
+#define ADD_BENCH(name) \
+  b.run(#name, inplace_merge_buffer_counting_bench<bench::name, int>)
+
+  ADD_BENCH(algo_inplace_merge);
+  ADD_BENCH(algo_inplace_merge_limited_allocation);
+  ADD_BENCH(std_inplace_merge);
+
+#undef ADD_BENCH
+}
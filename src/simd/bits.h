@@ -26,6 +26,14 @@ inline std::int32_t count_trailing_zeroes(std::uint32_t x) {
   return __builtin_ctz(x);
 }
 
+inline std::int32_t count_trailing_zeroes(std::uint64_t x) {
+  return __builtin_ctzll(x);
+}
+
+inline std::int32_t popcount(std::uint32_t x) {
+  return __builtin_popcount(x);
+}
+
 // https://stackoverflow.com/questions/18806481/how-can-i-get-the-position-of-the-least-significant-bit-in-a-number
 inline std::uint32_t lsb(std::uint32_t x) {
   return x & -x;
@@ -255,6 +255,15 @@ inline void store(register_i<{0}>* addr, register_i<{0}> a) {{
     return instantiateJustRegister(pattern)
 
 
+def storeu():
+    pattern = '''
+inline void storeu(register_i<{0}>* addr, register_i<{0}> a) {{
+  _mm{1}_storeu_si{0}(addr, a);
+}}
+'''
+    return instantiateJustRegister(pattern)
+
+
 # Set one value everywhere =======================================
 
 def set0():
@@ -468,6 +477,62 @@ def blendv():
 '''
 
 
+# shuffle ==============================================
+
+def permutevar():
+    return '''
+  // Lane crossing shuffle. Element i is taken from idx[i].
+  // There is no 128 bit version and 256 bit version works only on 32 bits.
+  template <typename T, typename Register>
+  inline auto permutevar(Register a, Register idx) {
+    static constexpr size_t register_width = bit_width<Register>();
+    static constexpr size_t t_width = sizeof(T) * 8;
+
+    if constexpr (register_width == 256 && t_width == 32)
+      return _mm256_permutevar8x32_epi32(a, idx);
+    else if constexpr (register_width == 512 && t_width == 32)
+      return _mm512_permutexvar_epi32(idx, a);
+    else if constexpr (register_width == 512 && t_width == 64)
+      return _mm512_permutexvar_epi64(idx, a);
+    else return error_t{ };
+  }
+'''
+
+
+# gather ===============================================
+
+def gather():
+    return '''
+  // Element i is base[idx[i]]. Idx is the type of indexes, they are signed
+  // for the instruction. 64 bit elements with 32 bit indexes take
+  // an index register of half the width.
+  template <typename T, typename Idx, typename Register>
+  inline auto gather(const T* base, Register idx) {
+    static constexpr size_t register_width = bit_width<Register>();
+    static constexpr size_t t_width = sizeof(T) * 8;
+    static constexpr size_t idx_width = sizeof(Idx) * 8;
+
+    if constexpr (register_width == 128 && t_width == 32 && idx_width == 32)
+      return _mm_i32gather_epi32((const int*)base, idx, 4);
+    else if constexpr (register_width == 256 && t_width == 32 && idx_width == 32)
+      return _mm256_i32gather_epi32((const int*)base, idx, 4);
+    else if constexpr (register_width == 512 && t_width == 32 && idx_width == 32)
+      return _mm512_i32gather_epi32(idx, base, 4);
+    else if constexpr (register_width == 128 && t_width == 64 && idx_width == 64)
+      return _mm_i64gather_epi64((const long long*)base, idx, 8);
+    else if constexpr (register_width == 256 && t_width == 64 && idx_width == 64)
+      return _mm256_i64gather_epi64((const long long*)base, idx, 8);
+    else if constexpr (register_width == 512 && t_width == 64 && idx_width == 64)
+      return _mm512_i64gather_epi64(idx, base, 8);
+    else if constexpr (register_width == 128 && t_width == 64 && idx_width == 32)
+      return _mm256_i32gather_epi64((const long long*)base, idx, 8);
+    else if constexpr (register_width == 256 && t_width == 64 && idx_width == 32)
+      return _mm512_i32gather_epi64(idx, base, 8);
+    else return error_t{ };
+  }
+'''
+
+
 def generateMainCode():
     res = ''
     res += section('register_i')
@@ -480,6 +545,7 @@ def generateMainCode():
     res += load()
     res += loadu()
     res += store()
+    res += storeu()
 
     res += section('set one value everywhere')
     res += set0()
@@ -501,6 +567,12 @@ def generateMainCode():
     res += movemask()
     res += blendv()
 
+    res += section('shuffle')
+    res += permutevar()
+
+    res += section('gather')
+    res += gather()
+
     res += section('bitwise')
     res += and_()
     res += or_()
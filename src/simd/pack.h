@@ -26,6 +26,9 @@
 #include "simd/pack_detail/set.h"
 
 #include "simd/pack_detail/blend.h"
+#include "simd/pack_detail/gather.h"
+#include "simd/pack_detail/masks.h"
+#include "simd/pack_detail/shuffle.h"
 
 #include "simd/pack_detail/arithmetic_pairwise.h"
 
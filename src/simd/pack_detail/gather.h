@@ -0,0 +1,36 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SIMD_PACK_DETAIL_GATHER_H_
+#define SIMD_PACK_DETAIL_GATHER_H_
+
+#include <cstddef>
+
+#include "simd/pack_detail/pack_declaration.h"
+
+namespace simd {
+
+// Element i of the result is base[idx[i]].
+// 32 and 64 bit elements, indexes are 32 bit or the same width as elements.
+// Indexes are signed for the instruction: 32 bit ones are up to 2^31.
+template <typename T, typename Idx, std::size_t W>
+pack<T, W> gather(const T* base, const pack<Idx, W>& idx) {
+  return pack<T, W>{mm::gather<T, Idx>(base, idx.reg)};
+}
+
+}  // namespace simd
+
+#endif  // SIMD_PACK_DETAIL_GATHER_H_
@@ -21,8 +21,25 @@
 #include <cstdint>
 #include <type_traits>
 
+#include "simd/bits.h"
+#include "simd/pack_detail/load.h"
+#include "simd/pack_detail/pack_declaration.h"
+
 namespace simd {
 
+// Mostly for compile time masks, like the ones used by blends.
+template <typename Pack>
+vbool_t<Pack> mask_from_bools(const std::array<bool, size_v<Pack>>& bools) {
+  using vbool = vbool_t<Pack>;
+  using U = scalar_t<vbool>;
+
+  std::array<U, size_v<Pack>> res{};
+  for (std::size_t i = 0; i != res.size(); ++i) {
+    res[i] = bools[i] ? all_ones<U>() : U{0};
+  }
+  return load_unaligned<vbool>(res.data());
+}
+
 }  // namespace simd
 
 #endif  // SIMD_PACK_DETAIL_MASKS_H_
@@ -21,10 +21,20 @@
 #include "simd/pack_detail/pack_declaration.h"
 
 namespace simd {
+namespace _minmax_pairwise {
+
+// 64 bit min/max for 128/256 bit registers come with AVX-512VL.
+#ifdef __AVX512VL__
+constexpr bool native_64_bit = true;
+#else
+constexpr bool native_64_bit = false;
+#endif
+
+}  // namespace _minmax_pairwise
 
 template <typename T, std::size_t W>
 pack<T, W> min_pairwise(const pack<T, W>& x, const pack<T, W>& y) {
- if constexpr (sizeof(T) < 8) {
+  if constexpr (sizeof(T) < 8 || _minmax_pairwise::native_64_bit) {
     return pack<T, W>{mm::min<T>(x.reg, y.reg)};
   } else {
     // blend: if true take second.
@@ -34,7 +44,7 @@ pack<T, W> min_pairwise(const pack<T, W>& x, const pack<T, W>& y) {
 
 template <typename T, std::size_t W>
 pack<T, W> max_pairwise(const pack<T, W>& x, const pack<T, W>& y) {
-  if constexpr (sizeof(T) < 8) {
+  if constexpr (sizeof(T) < 8 || _minmax_pairwise::native_64_bit) {
     return pack<T, W>{mm::max<T>(x.reg, y.reg)};
   } else {
     // blend: if true take second.
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef SIMD_PACK_DETAIL_SHUFFLE_H_
+#define SIMD_PACK_DETAIL_SHUFFLE_H_
+
+#include <array>
+#include <cstdint>
+
+#include "simd/pack_detail/load.h"
+#include "simd/pack_detail/pack_cast.h"
+#include "simd/pack_detail/pack_declaration.h"
+
+namespace simd {
+
+// Element i of the result is x[idx[i]].
+template <typename T, std::size_t W>
+pack<T, W> shuffle(const pack<T, W>& x,
+                   const std::array<std::uint32_t, W>& idx) {
+  if constexpr (sizeof(T) == 8 && W == 4) {
+    // No 64 bit shuffle for 256 bit registers, shuffle 32 bit halves.
+    std::array<std::uint32_t, W * 2> halves_idx{};
+    for (std::size_t i = 0; i != W; ++i) {
+      halves_idx[2 * i] = idx[i] * 2;
+      halves_idx[2 * i + 1] = idx[i] * 2 + 1;
+    }
+    auto halves = cast<pack<std::uint32_t, W * 2>>(x);
+    return cast<pack<T, W>>(shuffle(halves, halves_idx));
+  } else {
+    using idx_pack = pack<unsigned_equivalent<T>, W>;
+
+    std::array<scalar_t<idx_pack>, W> idx_t{};
+    for (std::size_t i = 0; i != W; ++i) {
+      idx_t[i] = static_cast<scalar_t<idx_pack>>(idx[i]);
+    }
+    const auto idx_reg = load_unaligned<idx_pack>(idx_t.data()).reg;
+    return pack<T, W>{mm::permutevar<T>(x.reg, idx_reg)};
+  }
+}
+
+}  // namespace simd
+
+#endif  // SIMD_PACK_DETAIL_SHUFFLE_H_
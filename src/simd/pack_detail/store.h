@@ -27,6 +27,12 @@ void store(T* addr, const pack<T, W>& a) {
   mm::store(reinterpret_cast<reg_t*>(addr), a.reg);
 }
 
+template <typename T, std::size_t W>
+void store_unaligned(T* addr, const pack<T, W>& a) {
+  using reg_t = register_t<pack<T, W>>;
+  mm::storeu(reinterpret_cast<reg_t*>(addr), a.reg);
+}
+
 }  // namespace simd
 
 #endif  // SIMD_PACK_DETAIL_STORE_H_
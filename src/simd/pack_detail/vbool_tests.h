@@ -47,6 +47,18 @@ bool any_true_ignore_first_n(const pack<T, W>& x, std::uint32_t n) {
   return _vbool_tests::movemask(x) & ~set_lower_n_bits(n * sizeof(T));
 }
 
+template <typename T, std::size_t W>
+std::uint32_t count_true(const pack<T, W>& x) {
+  return static_cast<std::uint32_t>(popcount(_vbool_tests::movemask(x))) /
+         sizeof(T);
+}
+
+template <typename T, std::size_t W>
+std::uint32_t count_true_ignore_first_n(const pack<T, W>& x, std::uint32_t n) {
+  const std::uint32_t mask =
+      _vbool_tests::movemask(x) & ~set_lower_n_bits(n * sizeof(T));
+  return static_cast<std::uint32_t>(popcount(mask)) / sizeof(T);
+}
 
 template <typename T, std::size_t W>
 std::optional<std::uint32_t> first_true(const pack<T, W>& x) {
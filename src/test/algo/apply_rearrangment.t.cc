@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <forward_list>
 #include <random>
 #include <vector>
@@ -148,5 +149,121 @@ TEST_CASE("algorithm.apply_rearrangment_no_marker", "[algorithm]") {
   });
 }
 
+TEMPLATE_TEST_CASE("algorithm.apply_rearrangment_indices_copy", "[algorithm]",
+                   std::int32_t, std::uint32_t, std::int64_t, std::uint64_t,
+                   test_t) {
+  using T = TestType;
+  std::mt19937 g;
+
+  auto run_test = [&](size_t size, auto index) {
+    using N = decltype(index);
+
+    std::vector<T> in(size);
+    int i = 0;
+    std::generate(in.begin(), in.end(), [&]() mutable { return T(++i); });
+
+    auto [positions, marker] = lift_as_indices<N>(in.begin(), in.end());
+    std::shuffle(positions.begin(), positions.end(), g);
+
+    std::vector<T> expected(size);
+    std::transform(positions.begin(), positions.end(), expected.begin(),
+                   [&](N p) { return in[p]; });
+
+    std::vector<T> actual(size);
+    apply_rearrangment_indices_copy(positions.begin(), positions.end(),
+                                    in.begin(), actual.begin());
+    REQUIRE(expected == actual);
+  };
+
+  for (size_t size = 0; size < 50; ++size) {
+    run_test(size, std::uint32_t{});
+    run_test(size, std::uint64_t{});
+  }
+  for (size_t size : {1000u, 1234u, 8832u}) {
+    run_test(size, std::uint32_t{});
+    run_test(size, std::uint64_t{});
+  }
+}
+
+TEST_CASE("algorithm.apply_rearrangment_visited_bits", "[algorithm]") {
+  apply_rearrangement_test([](auto positions, auto f, auto) {
+    const auto saved_positions = positions;
+    apply_rearrangment_visited_bits(positions.begin(), positions.end(), f);
+    REQUIRE(saved_positions == positions);
+  });
+}
+
+TEST_CASE("algorithm.apply_rearrangment_blocked", "[algorithm]") {
+  std::mt19937 g;
+
+  auto run_test = [&](size_t size, auto alg) {
+    std::vector<test_t> expected(size);
+    int i = 0;
+    std::generate(expected.begin(), expected.end(),
+                  [&]() mutable { return test_t{++i}; });
+    std::vector<test_t> actual = expected;
+
+    auto [positions, base, marker] =
+        lift_as_vector(actual.begin(), actual.end());
+    std::shuffle(positions.begin(), positions.end(), g);
+    std::transform(positions.begin(), positions.end(), expected.begin(),
+                   [](auto p) { return *p; });
+
+    alg(positions, base, marker);
+    REQUIRE(expected == actual);
+  };
+
+  auto blocked = [](auto& positions, auto base, auto) {
+    apply_rearrangment_blocked(positions.begin(), positions.end(), base);
+  };
+
+  for (size_t size = 0; size < 50; ++size) run_test(size, blocked);
+  // Multiple blocks.
+  for (size_t size : {100000u, 300001u}) run_test(size, blocked);
+
+  // Big enough for apply_rearrangment to choose the blocked version.
+  run_test(apply_rearrangment_blocked_boundary / sizeof(test_t) + 17,
+           [](auto& positions, auto base, auto marker) {
+             apply_rearrangment(positions.begin(), positions.end(), base,
+                                marker);
+           });
+}
+
+TEST_CASE("algorithm.apply_rearrangment_indices", "[algorithm]") {
+  std::mt19937 g;
+
+  auto run_test = [&](size_t size, auto index) {
+    using N = decltype(index);
+
+    std::vector<test_t> expected(size);
+    int i = 0;
+    std::generate(expected.begin(), expected.end(),
+                  [&]() mutable { return test_t{++i}; });
+    std::vector<test_t> actual = expected;
+
+    auto [positions, marker] =
+        lift_as_indices<N>(actual.begin(), actual.end());
+    std::shuffle(positions.begin(), positions.end(), g);
+    std::transform(positions.begin(), positions.end(), expected.begin(),
+                   [&](N p) { return actual[p]; });
+
+    apply_rearrangment_indices(positions.begin(), positions.end(),
+                               actual.begin(), marker);
+    REQUIRE(expected == actual);
+  };
+
+  for (size_t size = 0; size < 50; ++size) {
+    run_test(size, std::uint32_t{});
+    run_test(size, std::uint64_t{});
+  }
+  for (size_t size : {1000u, 1234u, 8832u}) run_test(size, std::uint32_t{});
+
+  // Blocked.
+  run_test(apply_rearrangment_blocked_boundary / sizeof(test_t) + 17,
+           std::uint32_t{});
+  run_test(apply_rearrangment_blocked_boundary / sizeof(test_t) + 17,
+           std::uint64_t{});
+}
+
 }  // namespace
 }  // namespace algo
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/binary_search_interpolation.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "test/algo/lower_bound_generic_test.h"
+
+namespace algo {
+namespace {
+
+template <typename T>
+void lower_bound_interpolation_test(const std::vector<T>& input) {
+  check_lower_bound_positions(input, [&](const T& v) {
+    return algo::lower_bound_interpolation(input.begin(), input.end(), v) -
+           input.begin();
+  });
+}
+
+TEMPLATE_TEST_CASE("algorithm.lower_bound_interpolation", "[algorithm]",
+                   std::int32_t, std::uint32_t, std::int64_t, double) {
+  auto test = [](const std::vector<TestType>& input) {
+    lower_bound_interpolation_test(input);
+  };
+  for_each_uniform_lower_bound_input<TestType>(
+      lower_bound_test_sizes_below(100), test);
+  for_each_skewed_lower_bound_input<TestType>({100, 1000}, test);
+}
+
+TEST_CASE("algorithm.lower_bound_interpolation.extremes", "[algorithm]") {
+  // Powers of 2: interpolation moves by one element at a time.
+  std::vector<std::int64_t> powers;
+  for (int i = 0; i != 63; ++i) powers.push_back(std::int64_t(1) << i);
+  lower_bound_interpolation_test(powers);
+
+  // Neighbouring numbers that are equal as doubles.
+  const std::int64_t max = std::numeric_limits<std::int64_t>::max();
+  lower_bound_interpolation_test(
+      std::vector<std::int64_t>{max - 5, max - 4, max - 3, max - 2, max});
+}
+
+}  // namespace
+}  // namespace algo
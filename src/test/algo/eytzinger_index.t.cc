@@ -0,0 +1,94 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/eytzinger_index.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "test/algo/lower_bound_generic_test.h"
+
+namespace algo {
+namespace {
+
+void in_order(std::size_t k, std::size_t n, std::vector<std::size_t>& res) {
+  if (k > n) return;
+  in_order(2 * k, n, res);
+  res.push_back(k);
+  in_order(2 * k + 1, n, res);
+}
+
+TEST_CASE("algorithm.eytzinger_rank", "[algorithm]") {
+  for (std::size_t n = 1; n != 600; ++n) {
+    std::vector<std::size_t> nodes;
+    in_order(1, n, nodes);
+    for (std::size_t rank = 0; rank != n; ++rank) {
+      REQUIRE(detail::eytzinger_rank(nodes[rank], n) == rank);
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("algorithm.eytzinger_index", "[algorithm]", std::int32_t,
+                   std::int64_t, double) {
+  auto test = [](const std::vector<TestType>& input) {
+    const eytzinger_index index(input.begin(), input.end());
+    REQUIRE(index.size() == input.size());
+    check_lower_bound_positions(
+        input, [&](const TestType& v) { return index.lower_bound(v); });
+  };
+  for_each_uniform_lower_bound_input<TestType>(
+      lower_bound_test_sizes_below(300), test);
+}
+
+TEST_CASE("algorithm.eytzinger_index.comparator", "[algorithm]") {
+  std::vector<std::string> input{"z", "xy", "x", "m", "m", "ab", "a"};
+  const eytzinger_index index(input.begin(), input.end());
+
+  for (const std::string v : {"zz", "z", "n", "m", "b", "a", ""}) {
+    const auto expected = static_cast<std::size_t>(
+        std::lower_bound(input.begin(), input.end(), v, std::greater<>{}) -
+        input.begin());
+    REQUIRE(index.lower_bound(v, std::greater<>{}) == expected);
+  }
+}
+
+TEST_CASE("algorithm.eytzinger_index.move", "[algorithm]") {
+  std::vector<int> input(1000);
+  for (int i = 0; i != 1000; ++i) input[static_cast<std::size_t>(i)] = i;
+
+  eytzinger_index<int> index(input.begin(), input.end());
+  eytzinger_index<int> moved = std::move(index);
+  REQUIRE(moved.lower_bound(500) == 500u);
+  REQUIRE(moved.lower_bound(-1) == 0u);
+  REQUIRE(moved.lower_bound(1000) == 1000u);
+
+  REQUIRE(index.size() == 0u);
+  REQUIRE(index.lower_bound(500) == 0u);
+
+  index = std::move(moved);
+  REQUIRE(index.lower_bound(500) == 500u);
+  REQUIRE(moved.size() == 0u);
+  REQUIRE(moved.lower_bound(500) == 0u);
+}
+
+}  // namespace
+}  // namespace algo
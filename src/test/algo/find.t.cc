@@ -0,0 +1,112 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/find.h"
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "algo/binary_search_biased.h"
+#include "algo/find_nth.h"
+#include "simd/pack.h"
+#include "test/catch.h"
+
+namespace algo {
+namespace {
+
+template <typename T>
+void find_test(const std::vector<T>& data) {
+  std::vector<T> queries(data);
+  queries.push_back(0);
+  queries.push_back(100);
+
+  for (auto f = data.begin(); f != data.end(); ++f) {
+    for (const T& v : queries) {
+      REQUIRE(algo::find(f, data.end(), v) == std::find(f, data.end(), v));
+    }
+  }
+}
+
+template <typename T>
+void lower_bound_linear_test(const std::vector<T>& data) {
+  for (auto f = data.begin(); f != data.end(); ++f) {
+    for (int i = -1; i != 102; ++i) {
+      const T v = static_cast<T>(i);
+      REQUIRE(algo::lower_bound_linear(f, data.end(), v) ==
+              std::lower_bound(f, data.end(), v));
+    }
+  }
+}
+
+template <typename T>
+void find_nth_guarantied_test(const std::vector<T>& data) {
+  for (auto f = data.begin(); f != data.end(); ++f) {
+    const auto n = std::count(f, data.end(), *f);
+    auto expected = f;
+    for (std::ptrdiff_t i = 0; i != n; ++i) {
+      REQUIRE(algo::find_nth_guarantied(f, i, *f) == expected);
+      expected = std::find(expected + 1, data.end(), *f);
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("algorithm.find_simd", "[algorithm][simd]", std::int8_t,
+                   std::uint8_t, std::int16_t, std::int32_t, std::uint32_t,
+                   std::int64_t, std::uint64_t) {
+  for (std::size_t n = 0; n != 80; ++n) {
+    // Sorted, with duplicates.
+    std::vector<TestType> data(n);
+    for (std::size_t i = 0; i != n; ++i) {
+      data[i] = static_cast<TestType>(i / 3 + 1);
+    }
+
+    find_test(data);
+    lower_bound_linear_test(data);
+    find_nth_guarantied_test(data);
+
+    std::reverse(data.begin(), data.end());
+    find_test(data);
+    find_nth_guarantied_test(data);
+  }
+}
+
+// The range ends right before a page that can't be read.
+TEST_CASE("algorithm.find_simd.end_of_page", "[algorithm][simd]") {
+  const std::size_t page = static_cast<std::size_t>(simd::page_size());
+  void* memory = mmap(nullptr, 2 * page, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  REQUIRE(memory != MAP_FAILED);
+  auto* bytes = static_cast<std::byte*>(memory);
+  REQUIRE(mprotect(bytes + page, page, PROT_NONE) == 0);
+
+  int* l = reinterpret_cast<int*>(bytes + page);
+  for (std::ptrdiff_t n = 0; n != 20; ++n) {
+    int* f = l - n;
+    std::fill(f, l, 1);
+    REQUIRE(algo::find(f, l, 2) == l);
+    REQUIRE(algo::lower_bound_linear(f, l, 2) == l);
+    if (n) REQUIRE(algo::find_nth_guarantied(f, n - 1, 1) == l - 1);
+  }
+
+  munmap(memory, 2 * page);
+}
+
+}  // namespace
+}  // namespace algo
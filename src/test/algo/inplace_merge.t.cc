@@ -0,0 +1,106 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/inplace_merge.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "algo/comparisons.h"
+#include "test/algo/stability_test_util.h"
+
+namespace algo {
+namespace {
+
+// Runs merger(f, m, l) on the two sorted halves of different sizes,
+// both in a vector and in a list, and checks stability.
+template <typename Merger>
+void inplace_merge_test(Merger merger) {
+  std::mt19937 g;
+
+  for (int max_value : {3, 1000}) {
+    std::uniform_int_distribution<> dis(0, max_value);
+
+    for (std::size_t n1 : {0, 1, 2, 5, 16, 33, 100}) {
+      for (std::size_t n2 : {0, 1, 3, 8, 17, 64, 150}) {
+        std::vector<int> ints(n1 + n2);
+        std::generate(ints.begin(), ints.end(), [&] { return dis(g); });
+
+        auto expected = make_container_of_stable_unique_iota<std::vector>(ints);
+        const auto m = expected.begin() + static_cast<std::ptrdiff_t>(n1);
+        std::stable_sort(expected.begin(), m, less_by_first{});
+        std::stable_sort(m, expected.end(), less_by_first{});
+
+        auto actual = copy_container_of_stable_unique(expected);
+        auto actual_list = cast_container_of_stable_unique<std::list>(actual);
+
+        std::inplace_merge(expected.begin(), m, expected.end(),
+                           less_by_first{});
+
+        merger(actual.begin(),
+               actual.begin() + static_cast<std::ptrdiff_t>(n1),
+               actual.end());
+        REQUIRE(expected == actual);
+
+        merger(actual_list.begin(),
+               std::next(actual_list.begin(), static_cast<std::ptrdiff_t>(n1)),
+               actual_list.end());
+        REQUIRE(expected == cast_container_of_stable_unique<std::vector>(
+                                actual_list));
+      }
+    }
+  }
+}
+
+TEST_CASE("algorithm.inplace_merge", "[algorithm]") {
+  inplace_merge_test([](auto f, auto m, auto l) {
+    algo::inplace_merge(f, m, l, less_by_first{});
+  });
+}
+
+TEST_CASE("algorithm.inplace_merge_limited_allocation", "[algorithm]") {
+  for (std::ptrdiff_t max_buf_n : {0, 1, 7, 40, 10'000}) {
+    inplace_merge_test([&](auto f, auto m, auto l) {
+      algo::inplace_merge_limited_allocation(f, m, l, less_by_first{},
+                                             max_buf_n);
+    });
+  }
+}
+
+TEST_CASE("algorithm.inplace_merge_limited_buffer", "[algorithm]") {
+  inplace_merge_test([](auto f, auto m, auto l) {
+    // A third of the smaller range.
+    const auto n = std::min(std::distance(f, m), std::distance(m, l)) / 3;
+    std::vector<stable_unique> buf(static_cast<std::size_t>(n));
+    algo::inplace_merge_limited_buffer(f, m, l, less_by_first{}, buf.begin(),
+                                       n);
+  });
+}
+
+TEST_CASE("algorithm.inplace_merge.default_comparator", "[algorithm]") {
+  std::vector<int> v{1, 3, 5, 7, 9, 2, 4, 6, 8};
+  algo::inplace_merge(v.begin(), v.begin() + 5, v.end());
+  REQUIRE(v == std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9});
+}
+
+}  // namespace
+}  // namespace algo
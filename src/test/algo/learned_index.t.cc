@@ -0,0 +1,76 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/learned_index.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "test/algo/lower_bound_generic_test.h"
+
+namespace algo {
+namespace {
+
+template <typename T>
+void learned_index_test(const std::vector<T>& input, std::size_t max_error) {
+  const learned_index index(input.begin(), input.end(), max_error);
+  check_lower_bound_positions(input, [&](const T& v) {
+    return index.lower_bound(v) - input.begin();
+  });
+}
+
+TEMPLATE_TEST_CASE("algorithm.learned_index", "[algorithm]", std::int32_t,
+                   std::uint32_t, std::int64_t, double) {
+  for (std::size_t max_error : {0, 1, 4, 32}) {
+    auto test = [&](const std::vector<TestType>& input) {
+      learned_index_test(input, max_error);
+    };
+    for_each_uniform_lower_bound_input<TestType>({0, 1, 2, 3, 10, 100, 1000},
+                                                 test);
+    for_each_skewed_lower_bound_input<TestType>({1000}, test);
+  }
+}
+
+TEST_CASE("algorithm.learned_index.segments", "[algorithm]") {
+  // A line is one segment, two lines are two.
+  std::vector<int> input(1000);
+  for (int i = 0; i != 1000; ++i) {
+    input[static_cast<std::size_t>(i)] = i < 500 ? i * 3 : 1500 + i * 100;
+  }
+
+  const learned_index index(input.begin(), input.begin() + 500, 1);
+  REQUIRE(index.segments_count() == 1u);
+
+  const learned_index index2(input.begin(), input.end(), 1);
+  REQUIRE(index2.segments_count() == 2u);
+  learned_index_test(input, 1);
+}
+
+TEST_CASE("algorithm.learned_index.extremes", "[algorithm]") {
+  // Neighbouring numbers that are equal as doubles.
+  const std::int64_t max = std::numeric_limits<std::int64_t>::max();
+  const std::int64_t min = std::numeric_limits<std::int64_t>::min();
+  learned_index_test(std::vector<std::int64_t>{min, min + 1, 0, max - 5,
+                                               max - 4, max - 3, max},
+                     0);
+}
+
+}  // namespace
+}  // namespace algo
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/lower_bound_batch.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "test/algo/lower_bound_generic_test.h"
+
+namespace algo {
+namespace {
+
+template <typename Alg>
+void lower_bound_batch_test(Alg alg, bool sorted_queries) {
+  std::mt19937 g;
+
+  for_each_uniform_lower_bound_input<int>(
+      {0, 1, 2, 3, 15, 16, 17, 100, 1000}, [&](std::vector<int> input) {
+        const std::vector<int> pool = lower_bound_test_queries(input);
+        std::uniform_int_distribution<std::size_t> dis(0, pool.size() - 1);
+
+        for (std::size_t queries_n : {0, 1, 15, 16, 17, 33, 500}) {
+          std::vector<int> queries(queries_n);
+          std::generate(queries.begin(), queries.end(),
+                        [&] { return pool[dis(g)]; });
+          if (sorted_queries) std::sort(queries.begin(), queries.end());
+
+          std::vector<std::vector<int>::iterator> expected;
+          for (int v : queries) {
+            expected.push_back(
+                std::lower_bound(input.begin(), input.end(), v));
+          }
+
+          std::vector<std::vector<int>::iterator> actual(queries_n);
+          REQUIRE(alg(input.begin(), input.end(), queries.begin(),
+                      queries.end(), actual.begin()) == actual.end());
+          REQUIRE(expected == actual);
+        }
+      });
+}
+
+TEST_CASE("algorithm.lower_bound_batch", "[algorithm]") {
+  auto alg = [](auto... args) { return algo::lower_bound_batch(args...); };
+  lower_bound_batch_test(alg, false);
+  lower_bound_batch_test(alg, true);
+}
+
+TEST_CASE("algorithm.lower_bound_batch_sorted", "[algorithm]") {
+  auto alg = [](auto... args) {
+    return algo::lower_bound_batch_sorted(args...);
+  };
+  lower_bound_batch_test(alg, true);
+  // Correct, only slower, for queries in any order.
+  lower_bound_batch_test(alg, false);
+}
+
+TEST_CASE("algorithm.lower_bound_batch.comparator_and_list", "[algorithm]") {
+  const std::vector<int> input{9, 7, 7, 5, 3, 3, 1};
+  const std::list<int> queries{10, 9, 8, 7, 4, 3, 0};
+
+  std::vector<std::vector<int>::const_iterator> expected;
+  for (int v : queries) {
+    expected.push_back(
+        std::lower_bound(input.begin(), input.end(), v, std::greater<>{}));
+  }
+
+  std::vector<std::vector<int>::const_iterator> actual;
+  algo::lower_bound_batch(input.begin(), input.end(), queries.begin(),
+                          queries.end(), std::back_inserter(actual),
+                          std::greater<>{});
+  REQUIRE(expected == actual);
+
+  actual.clear();
+  algo::lower_bound_batch_sorted(input.begin(), input.end(), queries.begin(),
+                                 queries.end(), std::back_inserter(actual),
+                                 std::greater<>{});
+  REQUIRE(expected == actual);
+}
+
+}  // namespace
+}  // namespace algo
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TEST_ALGO_LOWER_BOUND_GENERIC_TEST_H
+#define TEST_ALGO_LOWER_BOUND_GENERIC_TEST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "test/catch.h"
+
+namespace algo {
+namespace detail {
+
+struct lower_bound_generic_test_impl {
+  template <typename T, typename Gen>
+  static std::vector<T> sorted_input(std::size_t n, Gen gen) {
+    std::vector<T> res(n);
+    std::generate(res.begin(), res.end(),
+                  [&] { return static_cast<T>(gen()); });
+    std::sort(res.begin(), res.end());
+    return res;
+  }
+
+  // Every element, its neighbours and both extremes of T.
+  template <typename T>
+  static std::vector<T> queries(const std::vector<T>& input) {
+    constexpr T lowest = std::numeric_limits<T>::lowest();
+    constexpr T max = std::numeric_limits<T>::max();
+
+    std::vector<T> res{lowest, max};
+    for (const T& x : input) {
+      res.push_back(x);
+      if (x != lowest) res.push_back(static_cast<T>(x - 1));
+      if (x != max) res.push_back(static_cast<T>(x + 1));
+    }
+    return res;
+  }
+
+  template <typename T, typename Alg, typename Control>
+  static void check(const std::vector<T>& input, Alg alg, Control ctrl) {
+    for (const T& v : queries(input)) {
+      const auto expected = static_cast<std::size_t>(
+          ctrl(input.begin(), input.end(), v) - input.begin());
+      REQUIRE(static_cast<std::size_t>(alg(v)) == expected);
+    }
+  }
+};
+
+}  // namespace detail
+
+inline std::vector<std::size_t> lower_bound_test_sizes_below(std::size_t n) {
+  std::vector<std::size_t> res(n);
+  std::iota(res.begin(), res.end(), std::size_t{0});
+  return res;
+}
+
+// Calls `test` with sorted inputs of every size in `sizes`.
+// Narrow range for duplicates, wide one for gaps between elements.
+template <typename T, typename Test>
+void for_each_uniform_lower_bound_input(const std::vector<std::size_t>& sizes,
+                                        Test test) {
+  std::mt19937 g;
+  for (int max : {5, 100000}) {
+    std::uniform_int_distribution<> dis(0, max);
+    for (std::size_t n : sizes) {
+      test(detail::lower_bound_generic_test_impl::sorted_input<T>(
+          n, [&] { return dis(g) * 2; }));
+    }
+  }
+}
+
+// Skewed: most of the elements are small.
+template <typename T, typename Test>
+void for_each_skewed_lower_bound_input(const std::vector<std::size_t>& sizes,
+                                       Test test) {
+  std::mt19937 g;
+  std::exponential_distribution<> dis(0.001);
+  for (std::size_t n : sizes) {
+    test(detail::lower_bound_generic_test_impl::sorted_input<T>(
+        n, [&] { return dis(g); }));
+  }
+}
+
+template <typename T>
+std::vector<T> lower_bound_test_queries(const std::vector<T>& input) {
+  return detail::lower_bound_generic_test_impl::queries(input);
+}
+
+// `alg(v)` returns the position of the lower bound of `v` in `input`.
+template <typename T, typename Alg>
+void check_lower_bound_positions(const std::vector<T>& input, Alg alg) {
+  detail::lower_bound_generic_test_impl::check(
+      input, alg, [](auto f, auto l, const T& v) {
+        return std::lower_bound(f, l, v);
+      });
+}
+
+// `alg(v)` returns the position of the upper bound of `v` in `input`.
+template <typename T, typename Alg>
+void check_upper_bound_positions(const std::vector<T>& input, Alg alg) {
+  detail::lower_bound_generic_test_impl::check(
+      input, alg, [](auto f, auto l, const T& v) {
+        return std::upper_bound(f, l, v);
+      });
+}
+
+}  // namespace algo
+
+#endif  // TEST_ALGO_LOWER_BOUND_GENERIC_TEST_H
@@ -16,6 +16,10 @@
 
 #include "algo/merge.h"
 
+#include <algorithm>
+#include <random>
+#include <vector>
+
 #include "test/catch.h"
 
 #include "test/algo/merge_generic_test.h"
@@ -31,5 +35,41 @@ TEST_CASE("merge", "[algorithm]") {
   merge_test([](auto... params) { algo::merge(params...); });
 }
 
+TEST_CASE("merge_branchless", "[algorithm]") {
+  merge_test([](auto... params) { algo::merge_branchless(params...); });
+}
+
+TEST_CASE("merge_branchless.stability", "[algorithm]") {
+  // Pointers are compared by the pointed values: equal values are
+  // distinguishable by the address, which checks that the kernel is stable.
+  std::mt19937 g;
+  std::uniform_int_distribution<> dis(0, 10);
+
+  std::vector<int> values(200);
+  std::generate(values.begin(), values.end(), [&] { return dis(g); });
+
+  for (std::size_t x_size = 0; x_size <= values.size(); x_size += 7) {
+    std::sort(values.begin(), values.begin() + x_size);
+    std::sort(values.begin() + x_size, values.end());
+
+    std::vector<const int*> ptrs(values.size());
+    std::transform(values.begin(), values.end(), ptrs.begin(),
+                   [](const int& x) { return &x; });
+
+    auto less = [](const int* x, const int* y) { return *x < *y; };
+
+    std::vector<const int*> expected(ptrs.size());
+    std::vector<const int*> actual(ptrs.size());
+
+    std::merge(ptrs.begin(), ptrs.begin() + x_size, ptrs.begin() + x_size,
+               ptrs.end(), expected.begin(), less);
+    algo::merge_branchless(ptrs.begin(), ptrs.begin() + x_size,
+                           ptrs.begin() + x_size, ptrs.end(), actual.begin(),
+                           less);
+
+    REQUIRE(expected == actual);
+  }
+}
+
 }  // namespace
 }  // namespace algo
@@ -16,8 +16,13 @@
 
 #include "algo/merge_biased.h"
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include "test/catch.h"
 
+#include "algo/comparisons.h"
 #include "test/algo/merge_generic_test.h"
 
 namespace algo {
@@ -31,5 +36,37 @@ TEST_CASE("algorithm.merge_biased_second", "[algorithm]") {
   merge_test([](auto... params) { algo::merge_biased_second(params...); });
 }
 
+TEST_CASE("algorithm.merge_adaptive", "[algorithm]") {
+  merge_test([](auto... params) { algo::merge_adaptive(params...); });
+  merge_test([](auto... params) { algo::merge_adaptive<1>(params...); });
+  merge_test([](auto... params) { algo::merge_adaptive<16>(params...); });
+}
+
+TEST_CASE("algorithm.merge_adaptive.alternating_runs", "[algorithm]") {
+  // Long runs from one side then from the other, equal elements
+  // on both sides at the boundaries.
+  std::vector<std::pair<int, int>> x;
+  std::vector<std::pair<int, int>> y;
+  for (int run = 0; run != 20; ++run) {
+    auto& to = run % 2 ? y : x;
+    const int length = run * 7 + 1;
+    for (int i = 0; i != length; ++i) {
+      to.emplace_back(run * 1000 + i, static_cast<int>(to.size()));
+    }
+    x.emplace_back(run * 1000 + length, -1);
+    y.emplace_back(run * 1000 + length, -2);
+  }
+
+  std::vector<std::pair<int, int>> expected(x.size() + y.size());
+  std::merge(x.begin(), x.end(), y.begin(), y.end(), expected.begin(),
+             less_by_first{});
+
+  std::vector<std::pair<int, int>> actual(x.size() + y.size());
+  REQUIRE(algo::merge_adaptive(x.begin(), x.end(), y.begin(), y.end(),
+                               actual.begin(),
+                               less_by_first{}) == actual.end());
+  REQUIRE(expected == actual);
+}
+
 }  // namespace
 }  // namespace algo
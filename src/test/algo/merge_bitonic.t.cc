@@ -0,0 +1,94 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/merge_bitonic.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "test/algo/merge_generic_test.h"
+
+namespace algo {
+namespace {
+
+TEST_CASE("algorithm.merge_bitonic", "[algorithm]") {
+  merge_test([](auto... params) { algo::merge_bitonic(params...); });
+}
+
+TEMPLATE_TEST_CASE("algorithm.merge_bitonic.integers", "[algorithm]",
+                   std::int32_t, std::uint32_t, std::int64_t, std::uint64_t) {
+  std::mt19937 g;
+
+  // Narrow range for a lot of duplicates, full range for the extremes.
+  for (auto [min, max] : {std::pair<TestType, TestType>{0, 3},
+                          {std::numeric_limits<TestType>::min(),
+                           std::numeric_limits<TestType>::max()}}) {
+    std::uniform_int_distribution<TestType> dis(min, max);
+
+    for (std::size_t n1 : {0, 1, 3, 4, 7, 8, 9, 16, 31, 100, 1000}) {
+      for (std::size_t n2 : {0, 1, 4, 5, 8, 17, 64, 333}) {
+        std::vector<TestType> x(n1);
+        std::vector<TestType> y(n2);
+        std::generate(x.begin(), x.end(), [&] { return dis(g); });
+        std::generate(y.begin(), y.end(), [&] { return dis(g); });
+        std::sort(x.begin(), x.end());
+        std::sort(y.begin(), y.end());
+
+        std::vector<TestType> expected(n1 + n2);
+        std::merge(x.begin(), x.end(), y.begin(), y.end(), expected.begin());
+
+        std::vector<TestType> actual(n1 + n2);
+        REQUIRE(algo::merge_bitonic(x.begin(), x.end(), y.begin(), y.end(),
+                                    actual.begin()) == actual.end());
+        REQUIRE(expected == actual);
+
+        std::fill(actual.begin(), actual.end(), 0);
+        algo::merge_bitonic(y.data(), y.data() + n2, x.data(), x.data() + n1,
+                            actual.data(), std::less<TestType>{});
+        REQUIRE(expected == actual);
+      }
+    }
+  }
+}
+
+TEST_CASE("algorithm.merge_bitonic_applicable", "[algorithm]") {
+  using vec_it = std::vector<int>::iterator;
+  using vec_cit = std::vector<int>::const_iterator;
+  using list_it = std::list<int>::iterator;
+
+  STATIC_REQUIRE(
+      detail::merge_bitonic_applicable<vec_cit, vec_cit, vec_it, std::less<>>());
+  STATIC_REQUIRE(
+      detail::merge_bitonic_applicable<int*, int*, int*, std::less<int>>());
+  STATIC_REQUIRE(
+      !detail::merge_bitonic_applicable<list_it, vec_it, vec_it, std::less<>>());
+  STATIC_REQUIRE(!detail::merge_bitonic_applicable<vec_it, vec_it, vec_it,
+                                                   std::greater<>>());
+  STATIC_REQUIRE(!detail::merge_bitonic_applicable<double*, double*, double*,
+                                                   std::less<>>());
+  STATIC_REQUIRE(!detail::merge_bitonic_applicable<short*, short*, short*,
+                                                   std::less<>>());
+}
+
+}  // namespace
+}  // namespace algo
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/merge_k.h"
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "algo/comparisons.h"
+
+namespace algo {
+namespace {
+
+using element = std::pair<int, int>;
+
+// Run i gets (sizes[i]) random elements, the second member is the position
+// in the concatenation of all runs, so any stability problem is visible.
+std::vector<std::vector<element>> make_runs(const std::vector<int>& sizes,
+                                            int max_value) {
+  static std::mt19937 g;
+  std::uniform_int_distribution<> dis(0, max_value);
+
+  std::vector<std::vector<element>> res;
+  int position = 0;
+  for (int size : sizes) {
+    std::vector<element> run(size);
+    for (auto& x : run) x.first = dis(g);
+    std::sort(run.begin(), run.end());
+    for (auto& x : run) x.second = position++;
+    res.push_back(std::move(run));
+  }
+  return res;
+}
+
+template <typename Runs>
+void merge_k_test_runs(const Runs& runs) {
+  std::vector<element> expected;
+  for (const auto& run : runs) {
+    expected.insert(expected.end(), run.begin(), run.end());
+  }
+  std::stable_sort(expected.begin(), expected.end(), less_by_first{});
+
+  std::vector<element> actual;
+  algo::merge_k(runs.begin(), runs.end(), std::back_inserter(actual),
+                less_by_first{});
+  REQUIRE(expected == actual);
+}
+
+void merge_k_test(const std::vector<int>& sizes) {
+  for (int max_value : {0, 10, 100000}) {
+    auto runs = make_runs(sizes, max_value);
+    merge_k_test_runs(runs);
+
+    std::vector<std::list<element>> lists;
+    for (const auto& run : runs) lists.emplace_back(run.begin(), run.end());
+    merge_k_test_runs(lists);
+  }
+}
+
+TEST_CASE("algorithm.merge_k.small", "[algorithm]") {
+  merge_k_test({});
+  merge_k_test({0});
+  merge_k_test({5});
+  merge_k_test({0, 0});
+  merge_k_test({3, 0});
+  merge_k_test({0, 3});
+  merge_k_test({1, 1, 1});
+  merge_k_test({10, 20, 30});
+  merge_k_test({0, 7, 0, 7, 0});
+}
+
+TEST_CASE("algorithm.merge_k.many_runs", "[algorithm]") {
+  for (int k : {2, 3, 5, 8, 63, 64, 65, 100}) {
+    merge_k_test(std::vector<int>(k, 50));
+  }
+}
+
+TEST_CASE("algorithm.merge_k.skewed", "[algorithm]") {
+  for (int k : {2, 7, 64}) {
+    std::vector<int> sizes(k, 3);
+    sizes[0] = 10000;
+    merge_k_test(sizes);
+
+    sizes[0] = 3;
+    sizes.back() = 10000;
+    merge_k_test(sizes);
+  }
+}
+
+TEST_CASE("algorithm.merge_k.returns_end", "[algorithm]") {
+  auto runs = make_runs({30, 1, 20}, 10);
+  std::vector<element> out(51);
+  REQUIRE(algo::merge_k(runs.begin(), runs.end(), out.begin()) == out.end());
+  REQUIRE(std::is_sorted(out.begin(), out.end()));
+}
+
+}  // namespace
+}  // namespace algo
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/parallel_apply_rearrangment.h"
+
+#include <algorithm>
+#include <forward_list>
+#include <random>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "algo/container_cast.h"
+#include "algo/positions.h"
+#include "test/algo/zeroed_int.h"
+
+namespace algo {
+namespace {
+
+using test_t = zeroed_int_regular;
+
+template <template <typename...> class C>
+void parallel_apply_rearrangment_test(std::size_t size,
+                                      work_stealing_pool& pool,
+                                      std::mt19937& g) {
+  std::vector<test_t> in(size);
+  int i = 0;
+  std::generate(in.begin(), in.end(), [&]() mutable { return test_t{++i}; });
+
+  auto actual = algo::container_cast<C>(in);
+  auto [positions, base, marker] = lift_as_vector(actual.begin(), actual.end());
+  std::shuffle(positions.begin(), positions.end(), g);
+
+  std::vector<test_t> expected(size);
+  std::transform(positions.begin(), positions.end(), expected.begin(),
+                 [](auto p) { return *p; });
+
+  parallel_apply_rearrangment(positions.begin(), positions.end(), base, marker,
+                              pool);
+  REQUIRE(std::equal(actual.begin(), actual.end(), expected.begin(),
+                     expected.end()));
+}
+
+TEST_CASE("algorithm.parallel_apply_rearrangment", "[algorithm]") {
+  std::mt19937 g;
+  for (std::size_t thread_count : {1, 2, 4}) {
+    work_stealing_pool pool(thread_count);
+    for (std::size_t size :
+         {0u, 1u, 2u, 10u, 1000u, 16385u, 100000u, 123457u}) {
+      parallel_apply_rearrangment_test<std::vector>(size, pool, g);
+    }
+    for (std::size_t size : {0u, 1u, 10u, 1000u}) {
+      parallel_apply_rearrangment_test<std::forward_list>(size, pool, g);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace algo
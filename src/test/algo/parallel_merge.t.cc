@@ -0,0 +1,111 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/parallel_merge.h"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "algo/comparisons.h"
+
+namespace algo {
+namespace {
+
+// Equal keys are distinguished by the second member: the first range
+// has even ones, the second odd, so stability violations show up.
+template <typename Merger>
+void parallel_merge_test(Merger merger) {
+  std::mt19937 g;
+  std::uniform_int_distribution<> dis(0, 100);
+
+  for (std::size_t thread_count : {1, 2, 3, 4}) {
+    work_stealing_pool pool(thread_count);
+
+    for (auto [n1, n2] : {std::pair<int, int>{0, 0},
+                          {0, 100000},
+                          {100000, 0},
+                          {1, 50000},
+                          {50000, 1},
+                          {17, 100},
+                          {40000, 40000},
+                          {300000, 700000},
+                          {7, 200000}}) {
+      std::vector<std::pair<int, int>> x(n1);
+      std::vector<std::pair<int, int>> y(n2);
+      for (int i = 0; i != n1; ++i) x[i] = {dis(g), 2 * i};
+      for (int i = 0; i != n2; ++i) y[i] = {dis(g), 2 * i + 1};
+      std::stable_sort(x.begin(), x.end(), less_by_first{});
+      std::stable_sort(y.begin(), y.end(), less_by_first{});
+
+      std::vector<std::pair<int, int>> expected(x.size() + y.size());
+      std::merge(x.begin(), x.end(), y.begin(), y.end(), expected.begin(),
+                 less_by_first{});
+
+      std::vector<std::pair<int, int>> actual(expected.size());
+      auto o = merger(x.begin(), x.end(), y.begin(), y.end(), actual.begin(),
+                      less_by_first{}, pool);
+
+      REQUIRE(o == actual.end());
+      REQUIRE(expected == actual);
+    }
+  }
+}
+
+TEST_CASE("algorithm.parallel_merge.merge_path_split", "[algorithm]") {
+  std::vector<int> x{1, 2, 2, 5};
+  std::vector<int> y{2, 3, 4};
+
+  auto split = [&](std::ptrdiff_t diag) {
+    return detail::merge_path_split(x.begin(), 4, y.begin(), 3, diag,
+                                    std::less<>{});
+  };
+
+  // 1 2x 2x 2y 3y 4y 5x
+  REQUIRE(split(0) == 0);
+  REQUIRE(split(1) == 1);
+  REQUIRE(split(2) == 2);
+  REQUIRE(split(3) == 3);
+  REQUIRE(split(4) == 3);
+  REQUIRE(split(6) == 3);
+  REQUIRE(split(7) == 4);
+}
+
+TEST_CASE("algorithm.parallel_merge", "[algorithm]") {
+  parallel_merge_test([](auto&&... args) {
+    return algo::parallel_merge(std::forward<decltype(args)>(args)...);
+  });
+}
+
+TEST_CASE("algorithm.parallel_merge_biased_first", "[algorithm]") {
+  parallel_merge_test([](auto&&... args) {
+    return algo::parallel_merge_biased_first(
+        std::forward<decltype(args)>(args)...);
+  });
+}
+
+TEST_CASE("algorithm.parallel_merge_biased_second", "[algorithm]") {
+  parallel_merge_test([](auto&&... args) {
+    return algo::parallel_merge_biased_second(
+        std::forward<decltype(args)>(args)...);
+  });
+}
+
+}  // namespace
+}  // namespace algo
@@ -0,0 +1,48 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/parallel_stable_sort.h"
+
+#include <vector>
+
+#include "test/catch.h"
+
+#include "test/algo/stable_sort_generic_test.h"
+
+namespace algo {
+namespace {
+
+TEST_CASE("algorithm.parallel_stable_sort", "[algorithm]") {
+  for (std::size_t thread_count : {1, 2, 4}) {
+    work_stealing_pool pool(thread_count);
+    stable_sort_random_access_test([&](auto f, auto l, auto r) {
+      algo::parallel_stable_sort(f, l, r, pool);
+    });
+  }
+}
+
+TEST_CASE("algorithm.parallel_stable_sort_n_buffered", "[algorithm]") {
+  work_stealing_pool pool(3);
+
+  stable_sort_random_access_test([&](auto f, auto l, auto r) {
+    using T = typename std::iterator_traits<decltype(f)>::value_type;
+    std::vector<T> buf(l - f);
+    algo::parallel_stable_sort_n_buffered(f, l - f, r, buf.begin(), pool);
+  });
+}
+
+}  // namespace
+}  // namespace algo
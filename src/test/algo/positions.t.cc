@@ -16,7 +16,9 @@
 
 #include "algo/positions.h"
 
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <list>
 #include <vector>
 
@@ -109,5 +111,61 @@ TEST_CASE("algorithm.lift_as_vector", "[algorithm]") {
   }
 }
 
+TEST_CASE("algorithm.lift", "[algorithm]") {
+  auto run_test = [](auto f, auto l) {
+    const auto [expected, expected_base, expected_marker] =
+        lift_as_vector(f, l);
+
+    using position = typename decltype(expected)::value_type;
+    std::vector<position> actual(expected.size());
+
+    auto [actual_l, base, marker] = lift(f, l, actual.begin());
+
+    REQUIRE(actual_l == actual.end());
+    REQUIRE(expected == actual);
+    REQUIRE(expected_base == base);
+    REQUIRE(expected_marker == marker);
+    REQUIRE(marker - base == actual.size());
+  };
+
+  std::vector<int> v(5);
+  run_test(v.begin(), v.end());
+  run_test(v.begin(), v.begin());
+
+  std::list<int> l(5);
+  run_test(l.begin(), l.end());
+  run_test(l.begin(), l.begin());
+}
+
+TEST_CASE("algorithm.lift_as_indices", "[algorithm]") {
+  std::vector<int> v(5);
+
+  {
+    auto [positions, marker] = lift_as_indices<std::uint32_t>(v.begin(),
+                                                              v.end());
+    REQUIRE(positions == std::vector<std::uint32_t>{0, 1, 2, 3, 4});
+    REQUIRE(marker == std::numeric_limits<std::uint32_t>::max());
+  }
+
+  {
+    auto [positions, marker] = lift_as_indices<std::uint64_t>(v.begin(),
+                                                              v.begin());
+    REQUIRE(positions.empty());
+    REQUIRE(marker == std::numeric_limits<std::uint64_t>::max());
+  }
+
+  STATIC_REQUIRE(fits_indices<std::uint8_t>(254));
+  STATIC_REQUIRE(!fits_indices<std::uint8_t>(255));
+  STATIC_REQUIRE(fits_indices<std::uint32_t>(std::uint64_t(1) << 31));
+  STATIC_REQUIRE(!fits_indices<std::uint32_t>(std::uint64_t(1) << 32));
+
+  std::size_t index_size = 0;
+  with_lifted_indices(v.begin(), v.end(), [&](auto lifted) {
+    REQUIRE(lifted.positions.size() == v.size());
+    index_size = sizeof(lifted.marker);
+  });
+  REQUIRE(index_size == sizeof(std::uint32_t));
+}
+
 }  // namespace
 }  // namespace algo
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/radix_stable_sort.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "test/algo/stable_sort_generic_test.h"
+
+namespace algo {
+namespace {
+
+template <typename T, typename Generator>
+void radix_stable_sort_type_test(Generator gen) {
+  std::mt19937 g;
+
+  for (size_t size : {0, 1, 2, 3, 10, 100, 1000, 10'001}) {
+    std::vector<T> input(size);
+    std::generate(input.begin(), input.end(), [&] { return gen(g); });
+
+    auto expected = input;
+    std::stable_sort(expected.begin(), expected.end());
+
+    auto actual = input;
+    algo::radix_stable_sort(actual.begin(), actual.end());
+    REQUIRE(expected == actual);
+  }
+}
+
+TEST_CASE("algorithm.radix_key", "[algorithm]") {
+  using detail::radix_key;
+
+  REQUIRE(radix_key(-1) < radix_key(0));
+  REQUIRE(radix_key(std::numeric_limits<int>::min()) < radix_key(-1));
+  REQUIRE(radix_key(0) < radix_key(std::numeric_limits<int>::max()));
+  REQUIRE(radix_key(std::int64_t{-5}) < radix_key(std::int64_t{3}));
+
+  REQUIRE(radix_key(-1.5) < radix_key(-1.0));
+  REQUIRE(radix_key(-1.0) < radix_key(0.0));
+  REQUIRE(radix_key(-0.0) == radix_key(0.0));
+  REQUIRE(radix_key(0.0) < radix_key(1e-300));
+  REQUIRE(radix_key(1.0) < radix_key(std::numeric_limits<double>::infinity()));
+  REQUIRE(radix_key(-std::numeric_limits<double>::infinity()) <
+          radix_key(std::numeric_limits<double>::lowest()));
+  REQUIRE(radix_key(-2.0f) < radix_key(1.0f));
+
+  REQUIRE(radix_key(std::pair{1u, 2u}) < radix_key(std::pair{1u, 3u}));
+  REQUIRE(radix_key(std::pair{1u, 5u}) < radix_key(std::pair{2u, 0u}));
+  REQUIRE(radix_key(std::pair{-1, 5u}) < radix_key(std::pair{0, 0u}));
+
+  REQUIRE(radix_key(uint_tuple<32, 32>{1u, 5u}) <
+          radix_key(uint_tuple<32, 32>{2u, 0u}));
+}
+
+TEST_CASE("algorithm.radix_stable_sort", "[algorithm]") {
+  stable_sort_random_access_test([](auto f, auto l, auto) {
+    algo::radix_stable_sort(f, l,
+                            [](const stable_unique& x) { return x.first.body; });
+  });
+}
+
+TEST_CASE("algorithm.radix_stable_sort.types", "[algorithm]") {
+  radix_stable_sort_type_test<int>(
+      std::uniform_int_distribution<int>{-1000, 1000});
+  radix_stable_sort_type_test<int>(std::uniform_int_distribution<int>{
+      std::numeric_limits<int>::min(), std::numeric_limits<int>::max()});
+  radix_stable_sort_type_test<std::int64_t>(
+      std::uniform_int_distribution<std::int64_t>{
+          std::numeric_limits<std::int64_t>::min(),
+          std::numeric_limits<std::int64_t>::max()});
+  radix_stable_sort_type_test<std::uint8_t>(
+      std::uniform_int_distribution<unsigned>{0, 255});
+  radix_stable_sort_type_test<std::uint64_t>(
+      std::uniform_int_distribution<std::uint64_t>{});
+  radix_stable_sort_type_test<double>(
+      std::uniform_real_distribution<double>{-1e10, 1e10});
+  radix_stable_sort_type_test<double>([](auto& g) {
+    // A lot of zeroes of both signs.
+    return std::uniform_int_distribution<int>{0, 1}(g) ? 0.0 : -0.0;
+  });
+  radix_stable_sort_type_test<float>(
+      std::uniform_real_distribution<float>{-1.0f, 1.0f});
+
+  radix_stable_sort_type_test<std::pair<std::uint32_t, std::uint32_t>>(
+      [](auto& g) {
+        std::uniform_int_distribution<std::uint32_t> dis{0, 50};
+        return std::pair{dis(g), dis(g)};
+      });
+  radix_stable_sort_type_test<uint_tuple<32, 32>>([](auto& g) {
+    std::uniform_int_distribution<std::uint32_t> dis{0, 50};
+    return uint_tuple<32, 32>{dis(g), dis(g)};
+  });
+#ifdef HAS_128_INTS
+  radix_stable_sort_type_test<uint_tuple<64, 64>>([](auto& g) {
+    std::uniform_int_distribution<std::uint64_t> dis;
+    return uint_tuple<64, 64>{dis(g) % 3, dis(g)};
+  });
+  radix_stable_sort_type_test<std::pair<std::uint64_t, std::uint64_t>>(
+      [](auto& g) {
+        std::uniform_int_distribution<std::uint64_t> dis;
+        return std::pair{dis(g), dis(g)};
+      });
+#endif  // HAS_128_INTS
+}
+
+}  // namespace
+}  // namespace algo
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/scratch_arena.h"
+
+#include <cstdint>
+#include <string>
+
+#include "test/catch.h"
+
+namespace algo {
+namespace {
+
+TEST_CASE("algorithm.scratch_arena", "[algorithm]") {
+  scratch_arena arena;
+  REQUIRE(arena.capacity() == 0);
+
+  int* ints = arena.reserve<int>(10);
+  REQUIRE(reinterpret_cast<std::uintptr_t>(ints) % scratch_arena_alignment ==
+          0);
+  REQUIRE(arena.capacity() >= 10 * sizeof(int));
+  REQUIRE(arena.capacity() % scratch_arena_alignment == 0);
+
+  const std::size_t capacity = arena.capacity();
+
+  // Fits - no reallocation.
+  REQUIRE(static_cast<void*>(arena.reserve<char>(capacity)) == ints);
+  REQUIRE(arena.capacity() == capacity);
+
+  arena.reserve<double>(capacity);
+  REQUIRE(arena.capacity() >= capacity * sizeof(double));
+
+  arena.release();
+  REQUIRE(arena.capacity() == 0);
+}
+
+TEST_CASE("algorithm.scratch_buffer", "[algorithm]") {
+  scratch_arena arena;
+
+  {
+    scratch_buffer<std::string> buf(arena, 3);
+    REQUIRE(buf.size() == 3);
+    REQUIRE(buf.end() - buf.begin() == 3);
+    for (const auto& s : buf) REQUIRE(s.empty());
+
+    *buf.begin() = std::string(100, 'a');
+  }
+
+  scratch_buffer<std::string> buf(arena, 3);
+  REQUIRE(buf.begin()->empty());
+}
+
+}  // namespace
+}  // namespace algo
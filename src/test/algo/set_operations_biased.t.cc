@@ -0,0 +1,55 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/set_operations_biased.h"
+
+#include <algorithm>
+
+#include "test/catch.h"
+
+#include "test/algo/set_operations_generic_test.h"
+
+namespace algo {
+namespace {
+
+TEST_CASE("algorithm.set_union_biased", "[algorithm]") {
+  set_operation_test(
+      [](auto... params) { return algo::set_union_biased(params...); },
+      [](auto... params) { return std::set_union(params...); });
+}
+
+TEST_CASE("algorithm.set_intersection_biased", "[algorithm]") {
+  set_operation_test(
+      [](auto... params) { return algo::set_intersection_biased(params...); },
+      [](auto... params) { return std::set_intersection(params...); });
+}
+
+TEST_CASE("algorithm.set_difference_biased", "[algorithm]") {
+  set_operation_test(
+      [](auto... params) { return algo::set_difference_biased(params...); },
+      [](auto... params) { return std::set_difference(params...); });
+}
+
+TEST_CASE("algorithm.set_symmetric_difference_biased", "[algorithm]") {
+  set_operation_test(
+      [](auto... params) {
+        return algo::set_symmetric_difference_biased(params...);
+      },
+      [](auto... params) { return std::set_symmetric_difference(params...); });
+}
+
+}  // namespace
+}  // namespace algo
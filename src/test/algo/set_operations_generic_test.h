@@ -0,0 +1,136 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TEST_ALGO_SET_OPERATIONS_GENERIC_TEST_H
+#define TEST_ALGO_SET_OPERATIONS_GENERIC_TEST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "algo/comparisons.h"
+
+namespace algo {
+namespace detail {
+
+struct set_operation_generic_test_impl {
+  using element = std::pair<int, int>;
+
+  // Keys are compared, the second member says where the element is from,
+  // so we check which of the equal elements made it to the output.
+  static std::vector<element> sorted_elements(std::mt19937& g,
+                                              std::size_t size, int max_key,
+                                              int origin) {
+    std::uniform_int_distribution<> dis(0, max_key);
+    std::vector<element> res(size);
+    for (auto& x : res) {
+      x = {dis(g), origin};
+      ++origin;
+    }
+    std::stable_sort(res.begin(), res.end(), less_by_first{});
+    return res;
+  }
+
+  template <typename C, typename Op, typename StdOp>
+  static void run_container_test(const std::vector<element>& x,
+                                 const std::vector<element>& y, Op op,
+                                 StdOp std_op) {
+    const C xc(x.begin(), x.end());
+    const C yc(y.begin(), y.end());
+
+    std::vector<element> expected;
+    std_op(xc.begin(), xc.end(), yc.begin(), yc.end(),
+           std::back_inserter(expected), less_by_first{});
+
+    std::vector<element> actual;
+    op(xc.begin(), xc.end(), yc.begin(), yc.end(), std::back_inserter(actual),
+       less_by_first{});
+
+    REQUIRE(expected == actual);
+  }
+
+  template <typename Op, typename StdOp>
+  static void ints_test(const std::vector<element>& x,
+                        const std::vector<element>& y, Op op, StdOp std_op) {
+    std::vector<int> x_ints(x.size());
+    std::vector<int> y_ints(y.size());
+    std::transform(x.begin(), x.end(), x_ints.begin(),
+                   [](const element& e) { return e.first; });
+    std::transform(y.begin(), y.end(), y_ints.begin(),
+                   [](const element& e) { return e.first; });
+
+    std::vector<int> expected(x.size() + y.size());
+    expected.erase(std_op(x_ints.begin(), x_ints.end(), y_ints.begin(),
+                          y_ints.end(), expected.begin()),
+                   expected.end());
+
+    std::vector<int> actual(x.size() + y.size());
+    auto actual_l = op(x_ints.begin(), x_ints.end(), y_ints.begin(),
+                       y_ints.end(), actual.begin());
+    REQUIRE(actual_l - actual.begin() ==
+            static_cast<std::ptrdiff_t>(expected.size()));
+    actual.erase(actual_l, actual.end());
+    REQUIRE(expected == actual);
+  }
+
+  template <typename Op, typename StdOp>
+  static void run(Op op, StdOp std_op) {
+    std::mt19937 g;
+
+    // Few keys for a lot of equal elements, more keys for long runs
+    // from one side.
+    for (int max_key : {3, 50, 1000}) {
+      for (std::size_t n1 = 0; n1 <= 40; n1 += 3) {
+        for (std::size_t n2 = 0; n2 <= 40; n2 += 5) {
+          const auto x = sorted_elements(g, n1, max_key, 0);
+          const auto y = sorted_elements(g, n2, max_key, 1000);
+
+          run_container_test<std::vector<element>>(x, y, op, std_op);
+          run_container_test<std::list<element>>(x, y, op, std_op);
+          ints_test(x, y, op, std_op);
+        }
+      }
+    }
+
+    // One range is much smaller than the other.
+    for (std::size_t small : {1, 5, 17}) {
+      const auto x = sorted_elements(g, 10000, 20000, 0);
+      const auto y = sorted_elements(g, small, 20000, 100000);
+
+      run_container_test<std::vector<element>>(x, y, op, std_op);
+      run_container_test<std::vector<element>>(y, x, op, std_op);
+      ints_test(x, y, op, std_op);
+      ints_test(y, x, op, std_op);
+    }
+  }
+};
+
+}  // namespace detail
+
+template <typename Op, typename StdOp>
+void set_operation_test(Op op, StdOp std_op) {
+  detail::set_operation_generic_test_impl::run(op, std_op);
+}
+
+}  // namespace algo
+
+#endif  // TEST_ALGO_SET_OPERATIONS_GENERIC_TEST_H
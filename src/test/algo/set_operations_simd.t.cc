@@ -0,0 +1,142 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/set_operations_simd.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "test/catch.h"
+
+namespace algo {
+namespace {
+
+template <typename T>
+std::vector<T> unique_sorted(std::mt19937& g, std::size_t size, T min,
+                             T max) {
+  std::uniform_int_distribution<T> dis(min, max);
+  std::set<T> res;
+  while (res.size() < size) res.insert(dis(g));
+  return {res.begin(), res.end()};
+}
+
+template <typename T, typename Op, typename StdOp>
+void simd_set_operation_test(Op op, StdOp std_op) {
+  std::mt19937 g;
+
+  // Narrow range for a lot of common elements, full range for the extremes.
+  for (auto [min, max] :
+       {std::pair<T, T>{0, 2000}, {std::numeric_limits<T>::min(),
+                                   std::numeric_limits<T>::max()}}) {
+    for (std::size_t n1 : {0, 1, 3, 4, 7, 8, 9, 16, 31, 100, 1000}) {
+      for (std::size_t n2 : {0, 1, 4, 5, 8, 17, 64, 333}) {
+        const auto x = unique_sorted<T>(g, n1, min, max);
+        const auto y = unique_sorted<T>(g, n2, min, max);
+
+        for (auto [f, s] : {std::pair{&x, &y}, std::pair{&y, &x}}) {
+          std::vector<T> expected(n1 + n2);
+          expected.erase(std_op(f->begin(), f->end(), s->begin(), s->end(),
+                                expected.begin()),
+                         expected.end());
+
+          std::vector<T> actual(n1 + n2);
+          actual.erase(op(f->begin(), f->end(), s->begin(), s->end(),
+                          actual.begin(), std::less<>{}),
+                       actual.end());
+          REQUIRE(expected == actual);
+
+          actual.clear();
+          op(f->data(), f->data() + f->size(), s->data(),
+             s->data() + s->size(), std::back_inserter(actual),
+             std::less<T>{});
+          REQUIRE(expected == actual);
+        }
+      }
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("algorithm.set_operations_simd", "[algorithm]",
+                   std::int32_t, std::uint32_t, std::int64_t, std::uint64_t) {
+  simd_set_operation_test<TestType>(
+      [](auto... params) { return algo::set_union_simd(params...); },
+      [](auto... params) { return std::set_union(params...); });
+  simd_set_operation_test<TestType>(
+      [](auto... params) { return algo::set_intersection_simd(params...); },
+      [](auto... params) { return std::set_intersection(params...); });
+  simd_set_operation_test<TestType>(
+      [](auto... params) { return algo::set_difference_simd(params...); },
+      [](auto... params) { return std::set_difference(params...); });
+  simd_set_operation_test<TestType>(
+      [](auto... params) {
+        return algo::set_symmetric_difference_simd(params...);
+      },
+      [](auto... params) { return std::set_symmetric_difference(params...); });
+}
+
+TEST_CASE("algorithm.set_operations_simd.long_runs", "[algorithm]") {
+  // Blocks of one range pass a lot of blocks of the other one.
+  std::vector<int> x;
+  std::vector<int> y;
+  for (int i = 0; i != 3000; ++i) {
+    if (i / 100 % 2 || i % 7 == 0) x.push_back(i);
+    if (i / 100 % 2 == 0 || i % 5 == 0) y.push_back(i);
+  }
+
+  std::vector<int> expected;
+  std::set_intersection(x.begin(), x.end(), y.begin(), y.end(),
+                        std::back_inserter(expected));
+  std::vector<int> actual;
+  algo::set_intersection_simd(x.begin(), x.end(), y.begin(), y.end(),
+                              std::back_inserter(actual));
+  REQUIRE(expected == actual);
+
+  expected.clear();
+  actual.clear();
+  std::set_difference(x.begin(), x.end(), y.begin(), y.end(),
+                      std::back_inserter(expected));
+  algo::set_difference_simd(x.begin(), x.end(), y.begin(), y.end(),
+                            std::back_inserter(actual));
+  REQUIRE(expected == actual);
+}
+
+TEST_CASE("algorithm.set_operations_simd_applicable", "[algorithm]") {
+  using vec_it = std::vector<int>::iterator;
+  using list_it = std::list<int>::iterator;
+
+  STATIC_REQUIRE(
+      detail::set_operations_simd_applicable<vec_it, const int*,
+                                             std::less<>>());
+  STATIC_REQUIRE_FALSE(
+      detail::set_operations_simd_applicable<list_it, vec_it, std::less<>>());
+  STATIC_REQUIRE_FALSE(
+      detail::set_operations_simd_applicable<vec_it, vec_it,
+                                             std::greater<>>());
+  STATIC_REQUIRE_FALSE(detail::set_operations_simd_applicable<
+                       std::vector<double>::iterator,
+                       std::vector<double>::iterator, std::less<>>());
+}
+
+}  // namespace
+}  // namespace algo
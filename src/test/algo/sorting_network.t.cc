@@ -0,0 +1,164 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/sorting_network.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <list>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "algo/comparisons.h"
+#include "algo/stable_sort.h"
+#include "test/catch.h"
+
+namespace algo {
+namespace {
+
+template <typename T>
+std::vector<T> random_values(std::mt19937& g, std::size_t size, T min, T max) {
+  std::uniform_int_distribution<T> dis(min, max);
+  std::vector<T> res(size);
+  std::generate(res.begin(), res.end(), [&] { return dis(g); });
+  return res;
+}
+
+TEMPLATE_TEST_CASE("algorithm.sort_network", "[algorithm]", std::int32_t,
+                   std::uint32_t, std::int64_t, std::uint64_t) {
+  using T = TestType;
+  std::mt19937 g;
+
+  auto run = [&](auto n_constant, T min, T max) {
+    constexpr std::size_t n = decltype(n_constant)::value;
+    for (int i = 0; i < 1000; ++i) {
+      auto actual = random_values<T>(g, n + 2, min, max);
+      auto expected = actual;
+      std::sort(expected.begin() + 1, expected.end() - 1);
+
+      algo::sort_network<n>(actual.data() + 1);
+      REQUIRE(expected == actual);
+    }
+  };
+
+  constexpr T min = std::numeric_limits<T>::min();
+  constexpr T max = std::numeric_limits<T>::max();
+
+  run(std::integral_constant<std::size_t, 8>{}, min, max);
+  run(std::integral_constant<std::size_t, 16>{}, min, max);
+  run(std::integral_constant<std::size_t, 32>{}, min, max);
+  run(std::integral_constant<std::size_t, 32>{}, T(0), T(3));
+  run(std::integral_constant<std::size_t, 32>{}, T(max - 3), max);
+}
+
+TEMPLATE_TEST_CASE("algorithm.sort_network_n", "[algorithm]", std::int32_t,
+                   std::uint64_t) {
+  using T = TestType;
+  std::mt19937 g;
+
+  for (std::size_t n = 0; n <= sorting_network_max_size; ++n) {
+    for (int i = 0; i < 100; ++i) {
+      auto values = random_values<T>(g, n, std::numeric_limits<T>::min(),
+                                     std::numeric_limits<T>::max());
+      std::deque<T> actual(values.begin(), values.end());
+      std::sort(values.begin(), values.end());
+
+      REQUIRE(algo::sort_network_n(actual.begin(), n) == actual.end());
+      REQUIRE(std::equal(values.begin(), values.end(), actual.begin()));
+    }
+  }
+}
+
+TEST_CASE("algorithm.stable_sort_network_by_first_n", "[algorithm]") {
+  std::mt19937 g;
+
+  for (std::size_t n = 0; n <= sorting_network_max_size; ++n) {
+    for (int i = 0; i < 100; ++i) {
+      auto keys = random_values<int>(g, n, -3, 3);
+
+      std::vector<std::pair<int, std::string>> actual;
+      for (std::size_t j = 0; j != n; ++j) {
+        actual.emplace_back(keys[j], std::to_string(j));
+      }
+      auto expected = actual;
+      std::stable_sort(expected.begin(), expected.end(), less_by_first{});
+
+      REQUIRE(algo::stable_sort_network_by_first_n(actual.begin(), n) ==
+              actual.end());
+      REQUIRE(expected == actual);
+    }
+  }
+}
+
+TEST_CASE("algorithm.sorting_network_applicable", "[algorithm]") {
+  using int_it = std::vector<int>::iterator;
+  using pair_it = std::vector<std::pair<std::uint16_t, std::string>>::iterator;
+
+  STATIC_REQUIRE(sorting_network_applicable<int_it, std::less<>>());
+  STATIC_REQUIRE(sorting_network_applicable<int_it, std::less<int>>());
+  STATIC_REQUIRE(sorting_network_applicable<std::int64_t*, std::less<>>());
+  STATIC_REQUIRE(sorting_network_applicable<pair_it, less_by_first>());
+
+  STATIC_REQUIRE_FALSE(sorting_network_applicable<int_it, std::greater<>>());
+  STATIC_REQUIRE_FALSE(sorting_network_applicable<short*, std::less<>>());
+  STATIC_REQUIRE_FALSE(sorting_network_applicable<double*, std::less<>>());
+  STATIC_REQUIRE_FALSE(
+      sorting_network_applicable<std::list<int>::iterator, std::less<>>());
+  STATIC_REQUIRE_FALSE(sorting_network_applicable<pair_it, std::less<>>());
+  STATIC_REQUIRE_FALSE(sorting_network_applicable<
+                       std::pair<std::int64_t, int>*, less_by_first>());
+}
+
+TEST_CASE("algorithm.stable_sort_with_sorting_network", "[algorithm]") {
+  std::mt19937 g;
+
+  for (std::size_t n : {0, 1, 31, 32, 33, 100, 1000, 1001}) {
+    {
+      auto actual = random_values<std::int64_t>(g, n, -100, 100);
+      auto expected = actual;
+      std::sort(expected.begin(), expected.end());
+
+      algo::stable_sort_sufficient_allocation(actual.begin(), actual.end());
+      REQUIRE(expected == actual);
+    }
+
+    {
+      auto keys = random_values<int>(g, n, -10, 10);
+      std::vector<std::pair<int, int>> actual;
+      for (std::size_t j = 0; j != n; ++j) actual.emplace_back(keys[j], j);
+
+      auto expected = actual;
+      std::stable_sort(expected.begin(), expected.end(), less_by_first{});
+
+      auto with_16_leaves = actual;
+      std::vector<std::pair<int, int>> buf(n);
+      algo::stable_sort_n_buffered<16>(with_16_leaves.begin(), n,
+                                       less_by_first{}, buf.begin());
+      REQUIRE(expected == with_16_leaves);
+
+      algo::stable_sort_sufficient_allocation(actual.begin(), actual.end(),
+                                              less_by_first{});
+      REQUIRE(expected == actual);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace algo
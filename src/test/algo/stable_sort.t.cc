@@ -16,6 +16,9 @@
 
 #include "algo/stable_sort.h"
 
+#include <iterator>
+#include <vector>
+
 #include "test/catch.h"
 
 #include "test/algo/stable_sort_generic_test.h"
@@ -41,5 +44,31 @@ TEST_CASE("algorithm.stable_sort_lifting", "[algorithm]") {
   });
 }
 
+TEST_CASE("algorithm.stable_sort_natural_runs", "[algorithm]") {
+  stable_sort_test([](auto... params) {
+    algo::stable_sort_natural_runs(params...);
+  });
+}
+
+TEST_CASE("algorithm.stable_sort_limited_allocation", "[algorithm]") {
+  for (std::ptrdiff_t max_buf_n : {0, 1, 7, 100, 10'000}) {
+    stable_sort_test([&](auto f, auto l, auto r) {
+      algo::stable_sort_limited_allocation(f, l, r, max_buf_n);
+    });
+  }
+}
+
+TEST_CASE("algorithm.stable_sort_n_limited_buffer", "[algorithm]") {
+  stable_sort_test([](auto f, auto l, auto r) {
+    using T = typename std::iterator_traits<decltype(f)>::value_type;
+    const auto n = std::distance(f, l);
+
+    // Exactly a third of what stable_sort_n_buffered needs.
+    std::vector<T> buf(n / 6);
+    algo::stable_sort_n_limited_buffer(f, n, r, buf.begin(),
+                                       decltype(n)(buf.size()));
+  });
+}
+
 }  // namespace
 }  // namespace algo
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/stable_sort_cached_key.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "test/algo/stable_sort_generic_test.h"
+
+namespace algo {
+namespace {
+
+TEST_CASE("algorithm.string_prefix_key", "[algorithm]") {
+  REQUIRE(string_prefix_key("") == 0);
+  REQUIRE(string_prefix_key("a") < string_prefix_key("b"));
+  REQUIRE(string_prefix_key("a") < string_prefix_key("aa"));
+  REQUIRE(string_prefix_key("ab") < string_prefix_key("b"));
+  REQUIRE(string_prefix_key("\x7f") < string_prefix_key("\x80"));
+  REQUIRE(string_prefix_key("abcdefgh1") == string_prefix_key("abcdefgh2"));
+
+  REQUIRE(string_prefix_key("https://a", 8) < string_prefix_key("https://b", 8));
+  REQUIRE(string_prefix_key("https://", 8) == 0);
+  REQUIRE(string_prefix_key("http", 8) == 0);
+}
+
+TEST_CASE("algorithm.stable_sort_lifting_cached_key", "[algorithm]") {
+  // Coarse key: a lot of ties go to the comparator.
+  stable_sort_test([](auto f, auto l, auto r) {
+    algo::stable_sort_lifting_cached_key(
+        f, l, r, [](const auto& x) { return x.first.body / 4; });
+  });
+}
+
+TEST_CASE("algorithm.stable_sort_lifting_cached_key.strings", "[algorithm]") {
+  std::mt19937 g;
+  std::uniform_int_distribution<> length(0, 20);
+  std::uniform_int_distribution<> c('a', 'c');
+
+  std::vector<std::string> v(1000);
+  for (auto& s : v) {
+    s = "https://";
+    for (int i = length(g); i; --i) s += static_cast<char>(c(g));
+  }
+
+  auto expected = v;
+  std::sort(expected.begin(), expected.end());
+
+  algo::stable_sort_lifting_cached_key(
+      v.begin(), v.end(), std::less<>{},
+      [](const std::string& s) { return string_prefix_key(s, 8); });
+
+  REQUIRE(expected == v);
+}
+
+}  // namespace
+}  // namespace algo
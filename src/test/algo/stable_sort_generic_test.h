@@ -32,6 +32,7 @@
 namespace algo {
 namespace detail {
 
+template <bool test_lists = true>
 struct stable_sort_generic_test_impl {
   int big_reasonable_size;
 
@@ -51,10 +52,10 @@ struct stable_sort_generic_test_impl {
       REQUIRE(expected_vec == actual);
     }
 
-    const auto expected_list =
-        cast_container_of_stable_unique<std::list>(expected_vec);
+    if constexpr (test_lists) {
+      const auto expected_list =
+          cast_container_of_stable_unique<std::list>(expected_vec);
 
-    {
       auto actual = cast_container_of_stable_unique<std::list>(vec);
       sorter(actual.begin(), actual.end(), less_by_first{});
       REQUIRE(expected_list == actual);
@@ -109,11 +110,47 @@ struct stable_sort_generic_test_impl {
     }
   }
 
+  template <typename Sorter>
+  void test_partially_sorted(Sorter sorter) {
+    auto sorted = random_vector(big_reasonable_size);
+    std::sort(sorted.begin(), sorted.end());
+
+    run_test(sorted, sorter);
+
+    {
+      auto t = sorted;
+      std::reverse(t.begin(), t.end());
+      run_test(t, sorter);
+    }
+
+    for (int percentage : {1, 5, 20}) {
+      auto t = sorted;
+      std::uniform_int_distribution<size_t> dis(0, t.size() - 1);
+      for (size_t i = 0; i < t.size() * percentage / 100; ++i) {
+        std::swap(t[dis(generator)], t[dis(generator)]);
+      }
+      run_test(t, sorter);
+    }
+
+    for (size_t block : {3, 50, 1000}) {
+      auto t = sorted;
+      for (size_t i = 0; i < t.size(); i += block) {
+        auto l = t.begin() + std::min(i + block, t.size());
+        if (i / block % 2) std::reverse(t.begin() + i, l);
+      }
+      run_test(t, sorter);
+
+      std::rotate(t.begin(), t.begin() + t.size() / 3, t.end());
+      run_test(t, sorter);
+    }
+  }
+
   template <typename Sorter>
   void run(Sorter sorter) {
     special_cases(sorter);
     test_small_permutations(sorter);
     test_rather_big_ranges(sorter);
+    test_partially_sorted(sorter);
   }
 };
 
@@ -124,6 +161,11 @@ void stable_sort_test(Sorter sorter) {
   detail::stable_sort_generic_test_impl{10'000}.run(sorter);
 }
 
+template <typename Sorter>
+void stable_sort_random_access_test(Sorter sorter) {
+  detail::stable_sort_generic_test_impl<false>{10'000}.run(sorter);
+}
+
 template <typename Sorter>
 void stable_sort_quadratic_test(Sorter sorter) {
   detail::stable_sort_generic_test_impl{100}.run(sorter);
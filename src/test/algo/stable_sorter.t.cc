@@ -0,0 +1,66 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/stable_sorter.h"
+
+#include <vector>
+
+#include "test/catch.h"
+
+#include "test/algo/stable_sort_generic_test.h"
+
+namespace algo {
+namespace {
+
+TEST_CASE("algorithm.stable_sorter", "[algorithm]") {
+  stable_sort_test([](auto f, auto l, auto r) {
+    using T = typename std::iterator_traits<decltype(f)>::value_type;
+    static stable_sorter<T> sorter;
+    sorter.sort(f, l, r);
+  });
+}
+
+TEST_CASE("algorithm.stable_sorter_lifting", "[algorithm]") {
+  stable_sort_test([](auto f, auto l, auto r) {
+    using T = typename std::iterator_traits<decltype(f)>::value_type;
+    static stable_sorter<T> sorter;
+    sorter.sort_lifting(f, l, r);
+  });
+}
+
+TEST_CASE("algorithm.stable_sorter_reuses_memory", "[algorithm]") {
+  stable_sorter<int> sorter;
+
+  std::vector<int> big(1000);
+  sorter.sort(big.begin(), big.end());
+  const std::size_t capacity = sorter.capacity();
+  REQUIRE(capacity >= 500 * sizeof(int));
+
+  std::vector<int> small{3, 2, 1};
+  for (int i = 0; i < 10; ++i) {
+    sorter.sort(big.begin(), big.end());
+    sorter.sort(small.begin(), small.end());
+    sorter.sort_lifting(small.begin(), small.end());
+  }
+  REQUIRE(capacity == sorter.capacity());
+  REQUIRE(small == std::vector<int>{1, 2, 3});
+
+  sorter.release();
+  REQUIRE(sorter.capacity() == 0);
+}
+
+}  // namespace
+}  // namespace algo
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/static_btree.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "test/algo/lower_bound_generic_test.h"
+
+namespace algo {
+namespace {
+
+template <typename T>
+void static_btree_test(const std::vector<T>& input) {
+  const static_btree index(input.begin(), input.end());
+  REQUIRE(index.size() == input.size());
+  check_lower_bound_positions(input,
+                              [&](const T& v) { return index.lower_bound(v); });
+  check_upper_bound_positions(input,
+                              [&](const T& v) { return index.upper_bound(v); });
+}
+
+TEMPLATE_TEST_CASE("algorithm.static_btree", "[algorithm]", std::int32_t,
+                   std::uint32_t, std::int64_t, std::uint64_t) {
+  // Sizes go over a few layers of the tree.
+  for_each_uniform_lower_bound_input<TestType>(
+      {0, 1, 2, 7, 8, 9, 15, 16, 17, 71, 72, 73, 100, 271, 272, 273, 1000,
+       5000, 6000},
+      [](const std::vector<TestType>& input) { static_btree_test(input); });
+}
+
+TEMPLATE_TEST_CASE("algorithm.static_btree.extremes", "[algorithm]",
+                   std::int32_t, std::uint32_t, std::int64_t,
+                   std::uint64_t) {
+  constexpr TestType min = std::numeric_limits<TestType>::min();
+  constexpr TestType max = std::numeric_limits<TestType>::max();
+
+  for (std::size_t n = 1; n != 40; ++n) {
+    std::vector<TestType> input(n, max);
+    static_btree_test(input);
+
+    std::fill(input.begin(), input.begin() + n / 2, min);
+    static_btree_test(input);
+  }
+}
+
+TEST_CASE("algorithm.static_btree.move", "[algorithm]") {
+  std::vector<int> input(1000);
+  for (int i = 0; i != 1000; ++i) input[static_cast<std::size_t>(i)] = i;
+
+  static_btree<int> index(input.begin(), input.end());
+  static_btree<int> moved = std::move(index);
+  REQUIRE(moved.lower_bound(500) == 500u);
+  REQUIRE(moved.upper_bound(500) == 501u);
+  REQUIRE(moved.lower_bound(-1) == 0u);
+  REQUIRE(moved.lower_bound(1000) == 1000u);
+
+  REQUIRE(index.size() == 0u);
+  REQUIRE(index.lower_bound(500) == 0u);
+
+  index = std::move(moved);
+  REQUIRE(index.lower_bound(500) == 500u);
+  REQUIRE(moved.size() == 0u);
+  REQUIRE(moved.lower_bound(500) == 0u);
+}
+
+}  // namespace
+}  // namespace algo
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/string_sort.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "test/catch.h"
+
+namespace algo {
+namespace {
+
+std::vector<std::string> random_strings(std::size_t size, std::size_t max_length,
+                                        std::string_view prefix) {
+  static std::mt19937 g;
+  std::uniform_int_distribution<std::size_t> length(0, max_length);
+  // Small alphabet for a lot of shared prefixes and duplicates.
+  std::uniform_int_distribution<int> c('a', 'd');
+
+  std::vector<std::string> res(size);
+  for (auto& s : res) {
+    s = prefix;
+    for (std::size_t i = length(g); i; --i) s += static_cast<char>(c(g));
+  }
+  return res;
+}
+
+template <std::size_t width>
+void string_sort_test() {
+  for (std::string_view prefix : {"", "https://", "https://www.long-prefix.com/"}) {
+    for (std::size_t size : {0, 1, 2, 15, 16, 17, 100, 1000}) {
+      for (std::size_t max_length : {0, 3, 10, 100}) {
+        const auto strings = random_strings(size, max_length, prefix);
+        auto expected = strings;
+        std::sort(expected.begin(), expected.end());
+
+        {
+          auto actual = strings;
+          algo::string_sort<width>(actual.begin(), actual.end());
+          REQUIRE(expected == actual);
+        }
+
+        {
+          std::vector<std::string_view> actual(strings.begin(), strings.end());
+          algo::string_sort<width>(actual.begin(), actual.end());
+          REQUIRE(std::equal(expected.begin(), expected.end(), actual.begin(),
+                             actual.end()));
+        }
+
+        {
+          std::vector<const char*> actual(strings.size());
+          std::transform(strings.begin(), strings.end(), actual.begin(),
+                         [](const std::string& s) { return s.c_str(); });
+          algo::string_sort<width>(actual.begin(), actual.end());
+          REQUIRE(std::equal(expected.begin(), expected.end(), actual.begin(),
+                             actual.end()));
+        }
+
+        {
+          std::vector<std::pair<std::string, int>> actual(strings.size());
+          std::transform(strings.begin(), strings.end(), actual.begin(),
+                         [](const std::string& s) { return std::pair{s, 0}; });
+          algo::string_sort<width>(
+              actual.begin(), actual.end(),
+              [](const auto& x) -> const std::string& { return x.first; });
+          REQUIRE(std::equal(
+              expected.begin(), expected.end(), actual.begin(), actual.end(),
+              [](const auto& x, const auto& y) { return x == y.first; }));
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("algorithm.string_sort", "[algorithm]") {
+  string_sort_test<16>();
+  string_sort_test<32>();
+}
+
+TEST_CASE("algorithm.string_sort.non_ascii", "[algorithm]") {
+  std::vector<std::string> actual(100);
+  for (std::size_t i = 0; i < actual.size(); ++i) {
+    actual[i] = "x" + std::string(1, static_cast<char>(i * 5 + 1)) + "y";
+  }
+  auto expected = actual;
+  std::sort(expected.begin(), expected.end());
+
+  algo::string_sort<16>(actual.begin(), actual.end());
+  REQUIRE(expected == actual);
+}
+
+}  // namespace
+}  // namespace algo
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2019 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/work_stealing_pool.h"
+
+#include <atomic>
+#include <cstdint>
+
+#include "test/catch.h"
+
+namespace algo {
+namespace {
+
+std::int64_t sum_recursive(work_stealing_pool& pool, std::int64_t f,
+                           std::int64_t l) {
+  if (l - f <= 16) {
+    std::int64_t res = 0;
+    for (; f != l; ++f) res += f;
+    return res;
+  }
+
+  std::int64_t m = f + (l - f) / 2;
+  std::int64_t left = 0, right = 0;
+  pool.fork_join([&] { left = sum_recursive(pool, f, m); },
+                 [&] { right = sum_recursive(pool, m, l); });
+  return left + right;
+}
+
+TEST_CASE("algorithm.work_stealing_pool", "[algorithm]") {
+  for (std::size_t thread_count : {0, 1, 2, 3, 8}) {
+    work_stealing_pool pool(thread_count);
+    REQUIRE(pool.size() == (thread_count ? thread_count : 1));
+
+    {
+      int a = 0, b = 0;
+      pool.fork_join([&] { a = 1; }, [&] { b = 2; });
+      REQUIRE(a == 1);
+      REQUIRE(b == 2);
+    }
+
+    {
+      std::atomic<int> count{0};
+      for (int i = 0; i < 100; ++i) {
+        pool.fork_join([&] { ++count; }, [&] { ++count; });
+      }
+      REQUIRE(count == 200);
+    }
+
+    for (std::int64_t n : {0, 1, 17, 1000, 100'000}) {
+      REQUIRE(sum_recursive(pool, 0, n) == n * (n - 1) / 2);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace algo
@@ -99,6 +99,34 @@ TEST_CASE("bench.counters_to_json_dict", "[bench]") {
   REQUIRE(expected == actual.str());
 }
 
+TEST_CASE("bench.counters_to_json_dict.allocation", "[bench]") {
+  using base = detail::counting_wrapper_base;
+  clear_counters();
+  base::allocation = 2;
+
+  std::stringstream without;
+  counters_to_json_dict(without);
+  REQUIRE(without.str().find("allocation") == std::string::npos);
+
+  base::count_allocations = true;
+  std::stringstream actual;
+  counters_to_json_dict(actual);
+  base::count_allocations = false;
+
+  static constexpr std::string_view expected =  //
+      R"_({
+  "copy": 0,
+  "move": 0,
+  "equal": 0,
+  "less": 0,
+  "hash": 0,
+  "allocation": 2
+})_";
+
+  REQUIRE(expected == actual.str());
+  clear_counters();
+}
+
 TEST_CASE("bench.counters_writer", "[bench]") {
   std::stringstream actual;
   clear_counters();
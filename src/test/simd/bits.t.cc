@@ -34,6 +34,22 @@ TEST_CASE("bits.lsb_less", "[simd]") {
   REQUIRE(lsb_less(5u, 3u));  // 0101 0011
 }
 
+TEST_CASE("bits.count_trailing_zeroes", "[simd]") {
+  REQUIRE(0 == count_trailing_zeroes(std::uint32_t{1}));
+  REQUIRE(3 == count_trailing_zeroes(std::uint32_t{8}));
+  REQUIRE(31 == count_trailing_zeroes(std::uint32_t{1} << 31));
+  REQUIRE(0 == count_trailing_zeroes(std::uint64_t{1}));
+  REQUIRE(33 == count_trailing_zeroes(std::uint64_t{6} << 32));
+  REQUIRE(63 == count_trailing_zeroes(std::uint64_t{1} << 63));
+}
+
+TEST_CASE("bits.popcount", "[simd]") {
+  REQUIRE(0 == popcount(0u));
+  REQUIRE(1 == popcount(1u));
+  REQUIRE(2 == popcount(5u));
+  REQUIRE(32 == popcount(0xffffffff));
+}
+
 TEST_CASE("bits.set_lower_n_bits", "[simd]") {
   REQUIRE(0 == set_lower_n_bits(0));
   REQUIRE(1 == set_lower_n_bits(1));
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <array>
 #include <numeric>
+#include <type_traits>
 
 #include "test/catch.h"
 
@@ -238,6 +239,8 @@ TEMPLATE_TEST_CASE("simd.pack.comparisons_pairwise", "[simd]", ALL_TEST_PACKS) {
 
     REQUIRE_FALSE(all_true(mask));
     REQUIRE_FALSE(any_true(mask));
+    REQUIRE(count_true(mask) == 0u);
+    REQUIRE(count_true_ignore_first_n(mask, 1) == 0u);
     REQUIRE_FALSE(first_true(mask));
     REQUIRE_FALSE(any_true_ignore_first_n(mask, 0));
     REQUIRE_FALSE(first_true_ignore_first_n(mask, 0));
@@ -249,6 +252,8 @@ TEMPLATE_TEST_CASE("simd.pack.comparisons_pairwise", "[simd]", ALL_TEST_PACKS) {
 
     REQUIRE(all_true(mask));
     REQUIRE(any_true(mask));
+    REQUIRE(count_true(mask) == size);
+    REQUIRE(count_true_ignore_first_n(mask, 1) == size - 1);
     REQUIRE(first_true(mask) == 0u);
     REQUIRE(any_true_ignore_first_n(mask, 0));
     REQUIRE(first_true_ignore_first_n(mask, 0) == 0u);
@@ -260,6 +265,8 @@ TEMPLATE_TEST_CASE("simd.pack.comparisons_pairwise", "[simd]", ALL_TEST_PACKS) {
 
     REQUIRE_FALSE(all_true(mask));
     REQUIRE(any_true(mask));
+    REQUIRE(count_true(mask) == size - 1);
+    REQUIRE(count_true_ignore_first_n(mask, 1) == size - 1);
     REQUIRE(first_true(mask) == 1u);
     REQUIRE(any_true_ignore_first_n(mask, 0));
     REQUIRE(first_true_ignore_first_n(mask, 0) == 1u);
@@ -273,6 +280,9 @@ TEMPLATE_TEST_CASE("simd.pack.comparisons_pairwise", "[simd]", ALL_TEST_PACKS) {
 
     REQUIRE_FALSE(all_true(mask));
     REQUIRE(any_true(mask));
+    REQUIRE(count_true(mask) == 1u);
+    REQUIRE(count_true_ignore_first_n(mask, 0) == 1u);
+    REQUIRE(count_true_ignore_first_n(mask, 1) == 0u);
     REQUIRE(*first_true(mask) == 0u);
     REQUIRE(any_true_ignore_first_n(mask, 0));
     REQUIRE(first_true_ignore_first_n(mask, 0) == 0u);
@@ -381,6 +391,97 @@ TEMPLATE_TEST_CASE("simd.pack.set", "[simd]", ALL_TEST_PACKS) {
   }
 }
 
+TEMPLATE_TEST_CASE("simd.pack.gather", "[simd]", std::int32_t, std::uint32_t,
+                   std::int64_t, std::uint64_t) {
+  using T = TestType;
+
+  std::array<T, 100> base;
+  std::iota(base.begin(), base.end(), T(1));
+
+  auto run = [&](auto idx_pack) {
+    using idx_pack_t = decltype(idx_pack);
+    using Idx = scalar_t<idx_pack_t>;
+    constexpr size_t size = size_v<idx_pack_t>;
+
+    std::array<Idx, size> idx;
+    for (size_t i = 0; i != size; ++i) idx[i] = Idx(i * 7 % base.size());
+    idx[0] = Idx(base.size() - 1);
+
+    std::array<T, size> expected, actual;
+    for (size_t i = 0; i != size; ++i) expected[i] = base[idx[i]];
+
+    auto res = gather(base.data(), load_unaligned<idx_pack_t>(idx.data()));
+    is_same_test(res, pack<T, size>{});
+    store_unaligned(actual.data(), res);
+    REQUIRE(expected == actual);
+  };
+
+  using same_width_idx = std::make_unsigned_t<T>;
+  run(pack<same_width_idx, 16 / sizeof(T)>{});
+  run(pack<same_width_idx, 32 / sizeof(T)>{});
+  if constexpr (sizeof(T) == 8) run(pack<std::uint32_t, 4>{});
+}
+
+TEMPLATE_TEST_CASE("simd.pack.shuffle/masks", "[simd]",
+                   (pack<std::int32_t, 8>), (pack<std::uint32_t, 8>),
+                   (pack<std::int64_t, 4>), (pack<std::uint64_t, 4>)) {
+  using pack_t = TestType;
+  using scalar = scalar_t<pack_t>;
+  using vbool = vbool_t<pack_t>;
+  using bool_t = scalar_t<vbool>;
+  constexpr size_t size = size_v<pack_t>;
+
+  alignas(pack_t) std::array<scalar, size> a, expected, actual;
+  std::iota(a.begin(), a.end(), (scalar)1);
+  const pack_t x = load<pack_t>(a.data());
+
+  SECTION("store_unaligned") {
+    std::array<scalar, size + 1> out{};
+    store_unaligned(out.data() + 1, x);
+    REQUIRE(std::equal(a.begin(), a.end(), out.begin() + 1));
+    REQUIRE(out[0] == 0);
+  }
+
+  SECTION("shuffle") {
+    auto run = [&](std::array<std::uint32_t, size> idx) {
+      for (size_t i = 0; i != size; ++i) expected[i] = a[idx[i]];
+      store(actual.data(), shuffle(x, idx));
+      REQUIRE(expected == actual);
+    };
+
+    std::array<std::uint32_t, size> idx;
+    std::iota(idx.begin(), idx.end(), 0u);
+    run(idx);
+
+    std::reverse(idx.begin(), idx.end());
+    run(idx);
+
+    idx.fill(1);
+    run(idx);
+
+    for (size_t i = 0; i != size; ++i) idx[i] = i ^ 1;
+    run(idx);
+  }
+
+  SECTION("mask_from_bools") {
+    alignas(vbool) std::array<bool_t, size> expected_mask, actual_mask;
+
+    std::array<bool, size> bools{};
+    for (size_t i = 0; i < size; i += 3) bools[i] = true;
+
+    for (size_t i = 0; i != size; ++i) {
+      expected_mask[i] = bools[i] ? all_ones<bool_t>() : 0;
+    }
+    store(actual_mask.data(), mask_from_bools<pack_t>(bools));
+    REQUIRE(expected_mask == actual_mask);
+
+    const pack_t zeros = set_zero<pack_t>();
+    for (size_t i = 0; i != size; ++i) expected[i] = bools[i] ? 0 : a[i];
+    store(actual.data(), blend(x, zeros, mask_from_bools<pack_t>(bools)));
+    REQUIRE(expected == actual);
+  }
+}
+
 TEST_CASE("simd.pack.address_manipulation", "[simd]") {
   SECTION("end_of_page") {
     auto call = [](std::uintptr_t ptr_bits) {